@@ -146,19 +146,29 @@ void AppState::onEnter()
 
 // public ----------------------------------------------------------------------------------------------------
 void AppState::update()
+{
+   // Every key and mouse event of the frame, fast typing and drag strokes arrive as several per frame
+   for (const InputEvent& event : inputEvents)
+   {
+      handleInputEvent(event);
+   }
+}
+
+// private ---------------------------------------------------------------------------------------------------
+void AppState::handleInputEvent(const InputEvent& event)
 {
    if (selectNewCharacter)
    {
       // Only process printable characters, not special keys like KEY_MOUSE
       // Also prevent character selection during playback
-      if (userInput >= 32 && userInput <= 126 && !visibleEntity->getCurrentAnimation().isPlaying())
+      if (event.key >= 32 && event.key <= 126 && !visibleEntity->getCurrentAnimation().isPlaying())
       {
-         drawingTool.setDrawingCharacter(static_cast<char>(userInput));
+         drawingTool.setDrawingCharacter(static_cast<char>(event.key));
          selectNewCharacter = false;
 
          // Update button text to show the new character
          std::string buttonText = "Current Character: " + std::string(1, drawingTool.getDrawingCharacter());
-         currentCharacterButton->setText(buttonText);
+         bool        resized    = currentCharacterButton->setText(buttonText);
 
          // Keep the currentCharacterButton selected to show it's active
          globalInputHandler.setSelectedButton(currentCharacterButton);
@@ -166,15 +176,16 @@ void AppState::update()
          // Update color display with new character
          updateCurrentColorsButtonText();
 
-         // Refresh all locked positions after text change
-         UIElement::updateAllLockedPositions();
+         // Refresh all locked positions if the text change resized the button
+         if (resized)
+            UIElement::updateAllLockedPositions();
       }
       // Don't process other inputs while waiting for character selection
    }
    else if (editingFrameDuration)
    {
       // Handle frame duration input (numbers, decimals, enter, escape)
-      if (userInput == '\n' || userInput == '\r' || userInput == KEY_ENTER) // Enter key
+      if (event.key == '\n' || event.key == '\r' || event.key == KEY_ENTER) // Enter key
       {
          // Try to parse the input as a float
          try
@@ -215,7 +226,7 @@ void AppState::update()
 
          // Button highlighting is now handled automatically by InputHandler
       }
-      else if (userInput == 27) // Escape key
+      else if (event.key == 27) // Escape key
       {
          // Cancel editing
          editingFrameDuration = false;
@@ -224,46 +235,170 @@ void AppState::update()
          // Button highlighting is now handled automatically by InputHandler
          updateFrameDurationButtonText();
       }
-      else if ((userInput >= '0' && userInput <= '9') || userInput == '.')
+      else if ((event.key >= '0' && event.key <= '9') || event.key == '.')
       {
          // Add valid characters to input
-         frameDurationInput += static_cast<char>(userInput);
+         frameDurationInput += static_cast<char>(event.key);
 
          // Update button text to show current input
          std::string buttonText = "Duration: " + frameDurationInput;
-         frameLengthButton->setText(buttonText);
-         UIElement::updateAllLockedPositions();
+         if (frameLengthButton->setText(buttonText))
+            UIElement::updateAllLockedPositions();
       }
-      else if (userInput == 8 || userInput == 127) // Backspace
+      else if (event.key == 8 || event.key == 127) // Backspace
       {
          // Remove last character
          if (!frameDurationInput.empty())
          {
             frameDurationInput.pop_back();
             std::string buttonText = "Duration: " + frameDurationInput;
-            frameLengthButton->setText(buttonText);
-            UIElement::updateAllLockedPositions();
+            if (frameLengthButton->setText(buttonText))
+               UIElement::updateAllLockedPositions();
          }
       }
    }
-   else if (userInput == KEY_MOUSE)
+   else if (event.isMouse())
    {
-      MEVENT* mouseEvent = globalInputHandler.getLastMouseEvent();
-      if (mouseEvent != nullptr)
+      Position mousePos = event.mousePosition;
+
+      // Button highlighting is now handled automatically by the InputHandler
+
+      if (event.buttonState & BUTTON2_PRESSED)
       {
-         Position mousePos(mouseEvent->x, mouseEvent->y);
+         mouseHandler.startCameraDrag(mousePos);
+      }
+      if (event.buttonState & BUTTON1_PRESSED)
+      {
+         mouseHandler.startDrawing();
 
+         // Check if mouse is over the sliders first
+         if (frameDurationSlider->mouseInBounds(mousePos) &&
+             !visibleEntity->getCurrentAnimation().isPlaying())
+         {
+            frameDurationSlider->setPositionFromMouse(mousePos);
+            updateFrameDurationFromSlider();
+            updateFrameDurationButtonText();
+         }
+         else if (brushSizeSlider->mouseInBounds(mousePos) &&
+                  !visibleEntity->getCurrentAnimation().isPlaying())
+         {
+            brushSizeSlider->setPositionFromMouse(mousePos);
+            updateBrushSizeFromSlider();
+            updateBrushSizeButtonText();
+         }
+         else if (colorEditWindowOpen)
+         {
+            // Handle color edit window sliders
+            bool handledByColorWindow = false;
+            if (backgroundRedSlider->mouseInBounds(mousePos))
+            {
+               backgroundRedSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+            else if (backgroundGreenSlider->mouseInBounds(mousePos))
+            {
+               backgroundGreenSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+            else if (backgroundBlueSlider->mouseInBounds(mousePos))
+            {
+               backgroundBlueSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+            else if (textRedSlider->mouseInBounds(mousePos))
+            {
+               textRedSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+            else if (textGreenSlider->mouseInBounds(mousePos))
+            {
+               textGreenSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+            else if (textBlueSlider->mouseInBounds(mousePos))
+            {
+               textBlueSlider->setPositionFromMouse(mousePos);
+               updateColorsFromSliders();
+               handledByColorWindow = true;
+            }
+
+            // If not handled by color window and mouse is not over the color window itself, allow normal drawing
+            if (!handledByColorWindow && !colorEditWindow->isMouseInWindow(mousePos) &&
+                !globalInputHandler.isMouseOverUI(mousePos) &&
+                !visibleEntity->getCurrentAnimation().isPlaying())
+            {
+               int worldX = event.mousePosition.getX() - currentCamera->getLengthOffset();
+               int worldY = event.mousePosition.getY() - currentCamera->getHeightOffset();
+
+               if (drawingTool.isErasing())
+               {
+                  // Erasing: use brush size
+                  drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
+               }
+               else
+               {
+                  // Drawing: use brush size
+                  drawingTool.drawAtPosition(visibleEntity, worldX, worldY);
+               }
+               updateButtonStates();
+            }
+         }
+         else if (!globalInputHandler.isMouseOverUI(mousePos) &&
+                  !visibleEntity->getCurrentAnimation().isPlaying())
+         {
+            int worldX = event.mousePosition.getX() - currentCamera->getLengthOffset();
+            int worldY = event.mousePosition.getY() - currentCamera->getHeightOffset();
+
+            if (drawingTool.isErasing())
+            {
+               // Erasing: use brush size
+               drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
+            }
+            else
+            {
+               // Drawing: use brush size
+               drawingTool.drawAtPosition(visibleEntity, worldX, worldY);
+            }
+            updateButtonStates();
+         }
+      }
+
+      if (event.buttonState & BUTTON2_RELEASED)
+      {
+         mouseHandler.stopCameraDrag();
+      }
+      if (event.buttonState & BUTTON1_RELEASED)
+      {
+         mouseHandler.stopDrawing();
+         // Button highlighting is now handled automatically by the InputHandler
+      }
+
+      if (event.buttonState & (BUTTON1_RELEASED | BUTTON1_CLICKED))
+      {
+         mouseHandler.stopDrawing();
+      }
+      if (event.buttonState & (BUTTON2_RELEASED | BUTTON2_CLICKED))
+      {
+         mouseHandler.stopCameraDrag();
+      }
+
+      if (event.buttonState & REPORT_MOUSE_POSITION)
+      {
          // Button highlighting is now handled automatically by the InputHandler
 
-         if (mouseEvent->bstate & BUTTON2_PRESSED)
+         if (mouseHandler.isCameraDragging())
          {
-            mouseHandler.startCameraDrag(mousePos);
+            Position currentMousePos = event.mousePosition;
+            mouseHandler.updateCameraDrag(currentMousePos);
          }
-         if (mouseEvent->bstate & BUTTON1_PRESSED)
+         else if (mouseHandler.isDrawing())
          {
-            mouseHandler.startDrawing();
-
-            // Check if mouse is over the sliders first
+            // Check if mouse is over the sliders during drag
             if (frameDurationSlider->mouseInBounds(mousePos) &&
                 !visibleEntity->getCurrentAnimation().isPlaying())
             {
@@ -280,7 +415,7 @@ void AppState::update()
             }
             else if (colorEditWindowOpen)
             {
-               // Handle color edit window sliders
+               // Handle color edit window sliders during drag
                bool handledByColorWindow = false;
                if (backgroundRedSlider->mouseInBounds(mousePos))
                {
@@ -324,13 +459,15 @@ void AppState::update()
                    !globalInputHandler.isMouseOverUI(mousePos) &&
                    !visibleEntity->getCurrentAnimation().isPlaying())
                {
-                  int worldX = mouseEvent->x - currentCamera->getLengthOffset();
-                  int worldY = mouseEvent->y - currentCamera->getHeightOffset();
+                  int worldX = event.mousePosition.getX() - currentCamera->getLengthOffset();
+                  int worldY = event.mousePosition.getY() - currentCamera->getHeightOffset();
 
                   if (drawingTool.isErasing())
                   {
                      // Erasing: use brush size
                      drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
+                     // Force display refresh for immediate visual feedback
+                     displayNeedsCleared = true;
                   }
                   else
                   {
@@ -343,13 +480,15 @@ void AppState::update()
             else if (!globalInputHandler.isMouseOverUI(mousePos) &&
                      !visibleEntity->getCurrentAnimation().isPlaying())
             {
-               int worldX = mouseEvent->x - currentCamera->getLengthOffset();
-               int worldY = mouseEvent->y - currentCamera->getHeightOffset();
+               int worldX = event.mousePosition.getX() - currentCamera->getLengthOffset();
+               int worldY = event.mousePosition.getY() - currentCamera->getHeightOffset();
 
                if (drawingTool.isErasing())
                {
                   // Erasing: use brush size
                   drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
+                  // Force display refresh for immediate visual feedback
+                  displayNeedsCleared = true;
                }
                else
                {
@@ -359,145 +498,8 @@ void AppState::update()
                updateButtonStates();
             }
          }
-
-         if (mouseEvent->bstate & BUTTON2_RELEASED)
-         {
-            mouseHandler.stopCameraDrag();
-         }
-         if (mouseEvent->bstate & BUTTON1_RELEASED)
-         {
-            mouseHandler.stopDrawing();
-            // Button highlighting is now handled automatically by the InputHandler
-         }
-
-         if (mouseEvent->bstate & (BUTTON1_RELEASED | BUTTON1_CLICKED))
-         {
-            mouseHandler.stopDrawing();
-         }
-         if (mouseEvent->bstate & (BUTTON2_RELEASED | BUTTON2_CLICKED))
-         {
-            mouseHandler.stopCameraDrag();
-         }
-
-         if (mouseEvent->bstate & REPORT_MOUSE_POSITION)
-         {
-            // Button highlighting is now handled automatically by the InputHandler
-
-            if (mouseHandler.isCameraDragging())
-            {
-               Position currentMousePos(mouseEvent->x, mouseEvent->y);
-               mouseHandler.updateCameraDrag(currentMousePos);
-            }
-            else if (mouseHandler.isDrawing())
-            {
-               // Check if mouse is over the sliders during drag
-               if (frameDurationSlider->mouseInBounds(mousePos) &&
-                   !visibleEntity->getCurrentAnimation().isPlaying())
-               {
-                  frameDurationSlider->setPositionFromMouse(mousePos);
-                  updateFrameDurationFromSlider();
-                  updateFrameDurationButtonText();
-               }
-               else if (brushSizeSlider->mouseInBounds(mousePos) &&
-                        !visibleEntity->getCurrentAnimation().isPlaying())
-               {
-                  brushSizeSlider->setPositionFromMouse(mousePos);
-                  updateBrushSizeFromSlider();
-                  updateBrushSizeButtonText();
-               }
-               else if (colorEditWindowOpen)
-               {
-                  // Handle color edit window sliders during drag
-                  bool handledByColorWindow = false;
-                  if (backgroundRedSlider->mouseInBounds(mousePos))
-                  {
-                     backgroundRedSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-                  else if (backgroundGreenSlider->mouseInBounds(mousePos))
-                  {
-                     backgroundGreenSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-                  else if (backgroundBlueSlider->mouseInBounds(mousePos))
-                  {
-                     backgroundBlueSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-                  else if (textRedSlider->mouseInBounds(mousePos))
-                  {
-                     textRedSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-                  else if (textGreenSlider->mouseInBounds(mousePos))
-                  {
-                     textGreenSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-                  else if (textBlueSlider->mouseInBounds(mousePos))
-                  {
-                     textBlueSlider->setPositionFromMouse(mousePos);
-                     updateColorsFromSliders();
-                     handledByColorWindow = true;
-                  }
-
-                  // If not handled by color window and mouse is not over the color window itself, allow normal drawing
-                  if (!handledByColorWindow && !colorEditWindow->isMouseInWindow(mousePos) &&
-                      !globalInputHandler.isMouseOverUI(mousePos) &&
-                      !visibleEntity->getCurrentAnimation().isPlaying())
-                  {
-                     int worldX = mouseEvent->x - currentCamera->getLengthOffset();
-                     int worldY = mouseEvent->y - currentCamera->getHeightOffset();
-
-                     if (drawingTool.isErasing())
-                     {
-                        // Erasing: use brush size
-                        drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
-                        // Force display refresh for immediate visual feedback
-                        displayNeedsCleared = true;
-                     }
-                     else
-                     {
-                        // Drawing: use brush size
-                        drawingTool.drawAtPosition(visibleEntity, worldX, worldY);
-                     }
-                     updateButtonStates();
-                  }
-               }
-               else if (!globalInputHandler.isMouseOverUI(mousePos) &&
-                        !visibleEntity->getCurrentAnimation().isPlaying())
-               {
-                  int worldX = mouseEvent->x - currentCamera->getLengthOffset();
-                  int worldY = mouseEvent->y - currentCamera->getHeightOffset();
-
-                  if (drawingTool.isErasing())
-                  {
-                     // Erasing: use brush size
-                     drawingTool.eraseAtPosition(visibleEntity, worldX, worldY);
-                     // Force display refresh for immediate visual feedback
-                     displayNeedsCleared = true;
-                  }
-                  else
-                  {
-                     // Drawing: use brush size
-                     drawingTool.drawAtPosition(visibleEntity, worldX, worldY);
-                  }
-                  updateButtonStates();
-               }
-            }
-         }
       }
    }
-
-   // Update the current colors button to show the selected colors every frame
-   // This ensures the custom colors are maintained even after button highlighting
-   setCurrentColorsButtonColors(currentColorsButton, currentTextColor, currentBackgroundColor,
-                                drawingTool.getDrawingCharacter());
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -886,9 +888,8 @@ void AppState::updateFrameDurationButtonText()
    }
 
    std::string buttonText = "Duration: " + durationText + "s";
-   frameLengthButton->setText(buttonText);
-   frameLengthButton->setBorder(false); // Maintain borderless state
-   UIElement::updateAllLockedPositions();
+   if (frameLengthButton->setText(buttonText))
+      UIElement::updateAllLockedPositions();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -929,9 +930,8 @@ void AppState::updateBrushSizeFromSlider()
 void AppState::updateBrushSizeButtonText()
 {
    std::string buttonText = "Brush size: " + std::to_string(drawingTool.getBrushSize()) + " characters";
-   brushSizeButton->setText(buttonText);
-   brushSizeButton->setBorder(false); // Maintain borderless state
-   UIElement::updateAllLockedPositions();
+   if (brushSizeButton->setText(buttonText))
+      UIElement::updateAllLockedPositions();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -1225,11 +1225,12 @@ void AppState::updateCurrentColorsButtonText()
 {
    std::string buttonText =
          "Current Colors: " + std::string(1, drawingTool.getDrawingCharacter()) + "\nClick to Edit";
-   currentColorsButton->setText(buttonText);
+   bool resized = currentColorsButton->setText(buttonText);
    // Only apply colors to the drawing character
    setCurrentColorsButtonColors(currentColorsButton, currentTextColor, currentBackgroundColor,
                                 drawingTool.getDrawingCharacter());
-   UIElement::updateAllLockedPositions();
+   if (resized)
+      UIElement::updateAllLockedPositions();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -1257,37 +1258,12 @@ void AppState::setCurrentColorsButtonColors(std::shared_ptr<Button> button, cons
       return;
    }
 
-   // Get the button's current sprite
-   Sprite&             sprite = button->getCurrentAnimationMutable().getCurrentFrameSpriteMutable();
-   std::vector<Pixel>& pixels = sprite.getPixelsMutable();
-
-   // Find the colon character in "Current Colors: x", then find the character 2 positions to the right
-   // This should be the example character after ": "
-   Position colonPos(-1, -1);
-
-   // First pass: find the colon character
-   for (const Pixel& pixel : pixels)
-   {
-      if (pixel.getCharacter() == ':')
-      {
-         colonPos = pixel.getPosition();
-         break;
-      }
-   }
-
-   // Second pass: find the character 2 positions to the right of the colon (after ": ")
-   if (colonPos.getX() >= 0)
+   // The example character sits 2 positions right of the colon in "Current Colors: x" on the first line,
+   // the button keeps its colors through highlighting until the text is laid out again
+   const std::string& text  = button->getText();
+   size_t             colon = text.find(':');
+   if (colon != std::string::npos && colon < text.find('\n'))
    {
-      for (Pixel& pixel : pixels)
-      {
-         if (pixel.getPosition().getX() == colonPos.getX() + 2 && pixel.getPosition().getY() == colonPos.getY())
-         {
-            // Create a new pixel with the updated colors
-            Pixel newPixel(pixel.getPosition(), pixel.getCharacter(), textColor, backgroundColor,
-                           pixel.getAttributes());
-            pixel = newPixel;
-            break; // Only update the one example character
-         }
-      }
+      button->setTextColors(colon + 2, 0, textColor, backgroundColor);
    }
 }
\ No newline at end of file
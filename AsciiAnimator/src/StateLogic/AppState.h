@@ -148,6 +148,14 @@ private:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void updateButtonStates();
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn handleInputEvent
+   ///
+   /// Handles one key or mouse event of the frame
+   /// @param event - Event from inputEvents
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void handleInputEvent(const InputEvent& event);
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn handleMouseEvents
    ///
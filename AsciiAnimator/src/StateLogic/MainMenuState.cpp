@@ -29,9 +29,17 @@ void MainMenuState::onEnter()
    // Add the main menu window to the input context
    globalInputHandler.addContext(mainMenuWindow);
 
-   mainMenu = PrintableFactory::loadUIElement("mainMenuSprite", true, false, mainMenuWindow);
-   mainMenu->setAllAnimationSpriteLayers(0);
-   mainMenu->setDynamicPosition(ScreenLockPosition::TOP_MIDDLE);
+   // The title sprite is large, load it in the background so the buttons are usable right away
+   mainMenu     = nullptr;
+   mainMenuLoad = PrintableFactory::loadUIElementAsync(
+       "mainMenuSprite", true, false, mainMenuWindow,
+       [this](std::shared_ptr<UIElement> loaded)
+       {
+          mainMenu = loaded;
+          mainMenu->setAllAnimationSpriteLayers(0);
+          mainMenu->setDynamicPosition(ScreenLockPosition::TOP_MIDDLE);
+          UIElement::updateAllLockedPositions();
+       });
 
    newAnimationButton = PrintableFactory::newButton("New Animation", &MainMenuState::newAnimationFunction,
                                                     this, mainMenuWindow);
@@ -63,13 +71,17 @@ void MainMenuState::update()
    // Handle animation browser input if active
    if (showAnimationBrowser && animationBrowserMenu)
    {
-      // Check for keyboard input specifically for the menu
-      // Note: userInput is set by the GameEngine's input handling
-      if (userInput != 0)
+      // Every key of the frame goes to the menu, mouse events are handled by the global InputHandler
+      for (const InputEvent& event : inputEvents)
       {
-         if (animationBrowserMenu->handleInput(userInput))
+         // A selection or cancel closes the browser, the keys after it are not meant for the menu
+         if (!showAnimationBrowser || !animationBrowserMenu)
          {
-            userInput = 0; // Clear input after handling
+            break;
+         }
+         if (!event.isMouse())
+         {
+            animationBrowserMenu->handleInput(event.key);
          }
       }
    }
@@ -88,6 +100,13 @@ void MainMenuState::onExit()
 {
    clear();
 
+   // Leaving before the title sprite finished loading, it must not be added to the closed window
+   if (mainMenuLoad)
+   {
+      mainMenuLoad->cancel();
+      mainMenuLoad = nullptr;
+   }
+
    ncursesWindows.at(0)->clearPrintables();
    if (mainMenuWindow)
    {
@@ -24,11 +24,12 @@ class MainMenuState : public GameState
 {
 private:
    // Main menu window
-   std::shared_ptr<NcursesWindow> mainMenuWindow;
-   std::shared_ptr<UIElement>     mainMenu;
-   std::shared_ptr<Button>        newAnimationButton;
-   std::shared_ptr<Button>        loadAnimationButton;
-   std::shared_ptr<Button>        quitButton;
+   std::shared_ptr<NcursesWindow>        mainMenuWindow;
+   std::shared_ptr<UIElement>            mainMenu;
+   std::shared_ptr<AsyncLoad<UIElement>> mainMenuLoad; // Background load of the mainMenu sprite
+   std::shared_ptr<Button>               newAnimationButton;
+   std::shared_ptr<Button>               loadAnimationButton;
+   std::shared_ptr<Button>               quitButton;
 
    // Animation browser menu
    std::shared_ptr<Menu> animationBrowserMenu;
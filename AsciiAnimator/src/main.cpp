@@ -10,13 +10,38 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "StateLogic/MainMenuState.h"
+#include <string>
 
 // public ----------------------------------------------------------------------------------------------------
-int main()
+int main(int argc, char* argv[])
 {
+   // --watch reloads animations edited on disk while the animator runs
+   // --input-thread reads input on its own thread so slow frames do not delay or drop mouse motion
+   // --record <file> writes the session's input and framebuffer hashes to file
+   // --replay <file> plays a recording back as fast as possible, --replay-realtime <file> at recorded pace.
+   // Replays draw headless, so they need no terminal.
+   bool inputThread = false;
+   for (int i = 1; i < argc; i++)
+   {
+      std::string argument = argv[i];
+      if (argument == "--watch")
+         AnimationWatcher::start();
+      else if (argument == "--input-thread")
+         inputThread = true;
+      else if (argument == "--record" && i + 1 < argc && !InputRecorder::startRecording(argv[++i]))
+         return 1;
+      else if ((argument == "--replay" || argument == "--replay-realtime") && i + 1 < argc &&
+               !InputRecorder::startReplay(argv[++i], argument == "--replay-realtime"))
+         return 1;
+   }
+
    GameEngine engine(new MainMenuState());
+   if (inputThread && !InputRecorder::isReplaying())
+      InputThread::start();
    engine.run();
-   return 0;
+
+   // A replay whose frames no longer match the recording fails, so it can gate rendering changes
+   return InputRecorder::getMismatchCount() > 0 ? 1 : 0;
 }
 
 // #include <locale.h>
@@ -13,12 +13,23 @@
 #define ANIMATION_H
 
 #include "Frame.h"
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <unordered_map>
+
+class FrameStream;
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @class Animation
 ///
 /// Defines an Animation which holds a vector of frames and advances through them
+///
+/// Frames can optionally be delta encoded (see encodeDeltas). The animation then keeps one decoded sprite
+/// for the current frame and patches it with each frame's delta as it advances.
+///
+/// Frames can also be streamed from disk (see setStream). The frames vector then only holds each frame's
+/// duration and layer, and the animation keeps just the current and previous frame taken from the stream.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class Animation
 {
@@ -32,9 +43,96 @@ private:
    size_t previousFrameIndex = 0;
    float  frameTimer         = -1.0f;
 
+   // Displacement since the frames were loaded, applied to frames streamed or replaced later
+   int m_offsetX = 0;
+   int m_offsetY = 0;
+
+   // Delta encoding state, only used while m_deltaEncoded is set
+   bool                                m_deltaEncoded      = false;
+   size_t                              m_keyframeInterval  = 0;
+   Sprite                              m_decodedSprite;
+   size_t                              m_decodedFrameIndex = 0;
+   std::unordered_map<int64_t, size_t> m_decodedCells;
+   std::vector<Position>               m_vacatedPositions;
+
+   // Streaming state, only used while m_stream is set
+   std::shared_ptr<FrameStream> m_stream;
+   Frame                        m_streamedFrame;
+   Frame                        m_previousStreamedFrame;
+   size_t                       m_streamedFrameIndex = 0;
+
+   // Changes whenever the frame or its timer is moved from outside applyFrameTimer, see getTimingVersion
+   uint64_t m_timingVersion = 0;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn cellKey
+   ///
+   /// @param position - Cell position
+   /// @return Key of the position in m_decodedCells
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static int64_t cellKey(const Position& position);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn samePixel
+   ///
+   /// @param a - First pixel
+   /// @param b - Second pixel
+   /// @return True if both pixels draw the same character, colors and attributes
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool samePixel(const Pixel& a, const Pixel& b);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn decodeFrame
+   ///
+   /// Brings the decoded sprite to the frame at index. Moving forward applies the deltas in between, any
+   /// other jump restarts from the nearest keyframe at or before index.
+   ///
+   /// @param index - Frame to decode
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void decodeFrame(const size_t index);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn applyDelta
+   ///
+   /// @param frame - Keyframe to load or delta frame to patch into the decoded sprite
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void applyDelta(const Frame& frame);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn indexDecodedSprite
+   ///
+   /// Rebuilds the position lookup of the decoded sprite
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void indexDecodedSprite();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn fetchStreamedFrame
+   ///
+   /// Takes the current frame from the stream. On an underrun the stream's newest earlier frame is shown,
+   /// or the frame on screen is kept.
+   ///
+   /// @param wait - Block until the frame is read, used when stepping frames by hand
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void fetchStreamedFrame(const bool wait);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn touchTiming
+   ///
+   /// Gives the animation a new timing version and flags windows to re-register their animations
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void touchTiming();
+
 public:
    Animation();
-   Animation(const std::string animationName, const std::vector<Frame> frames, const bool repeats);
+   Animation(const std::string animationName, std::vector<Frame> frames, const bool repeats);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// Copies of a streamed animation get a clone of its stream, so each copy keeps its own playhead
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   Animation(const Animation& other);
+   Animation(Animation&& other)                 = default;
+   Animation& operator=(const Animation& other);
+   Animation& operator=(Animation&& other)      = default;
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn update
@@ -45,6 +143,31 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void update(const float deltaTime);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn applyFrameTimer
+   ///
+   /// Stores an already advanced frame timer and steps past every frame whose duration has run out. Used by
+   /// AnimationClock, which advances many timers in one batch before handing them back.
+   ///
+   /// @param frameTimer - New value of the frame timer
+   /// @return True if the current frame changed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool applyFrameTimer(const float frameTimer);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrameTimer
+   ///
+   /// @return Time spent on the current frame so far
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float getFrameTimer() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getCurrentFrameDuration
+   ///
+   /// @return Duration of the current frame in seconds
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float getCurrentFrameDuration() const;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn getCurrentFrameSprite
    ///
@@ -153,6 +276,16 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    size_t getTotalFrames() const;
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTimingVersion
+   ///
+   /// Versions are unique across all animations, so a schedule made for one version is known to be stale
+   /// once frames are replaced, stepped by hand, paused or restarted.
+   ///
+   /// @return Version of the frame and timer state
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   uint64_t getTimingVersion() const;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn addFrame
    ///
@@ -190,6 +323,27 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    Frame& getFrameAtIndexMutable(size_t index);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn replaceFrame
+   ///
+   /// Swaps in a frame reloaded from disk. It is displaced like the animation's own frames and re-encoded
+   /// when the animation is delta encoded. Streamed animations are left alone, they read from disk anyway.
+   ///
+   /// @param index - Index of the frame to replace
+   /// @param frame - Frame as loaded from disk
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void replaceFrame(const size_t index, Frame frame);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn replaceFrames
+   ///
+   /// Swaps in every frame reloaded from disk, see replaceFrame. Playback keeps its position when the new
+   /// frames still reach it, otherwise it restarts at the first frame.
+   ///
+   /// @param frames - Frames as loaded from disk
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void replaceFrames(std::vector<Frame> frames);
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setRepeats
    ///
@@ -203,6 +357,66 @@ public:
    /// @return Boolean indicating if the animation should repeat
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    const bool& getRepeats() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn encodeDeltas
+   ///
+   /// Keeps every keyframeInterval'th frame whole and stores the others as the cells that differ from the
+   /// frame before. Meant for playback: delta frames have no pixels in getFrames/getFrameAtIndex, and edits
+   /// through getCurrentFrameSpriteMutable only last until the frame changes. Call decodeDeltas before
+   /// editing.
+   ///
+   /// @param keyframeInterval - Distance between keyframes, 0 decodes the animation back to full frames
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void encodeDeltas(const size_t keyframeInterval);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn decodeDeltas
+   ///
+   /// Restores the full sprite of every frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void decodeDeltas();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isDeltaEncoded
+   ///
+   /// @return True if frames are stored as keyframes and deltas
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isDeltaEncoded() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getVacatedPositions
+   ///
+   /// @return Positions emptied by frame changes since the last clearVacatedPositions, only filled for delta
+   /// encoded animations. Used to erase just those cells instead of the whole previous sprite.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<Position>& getVacatedPositions() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clearVacatedPositions
+   ///
+   /// Called once the vacated cells have been erased
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clearVacatedPositions();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setStream
+   ///
+   /// Plays frames from a stream instead of the frames vector, which must then hold one frame per streamed
+   /// frame carrying its duration and layer (pixels are ignored). Blocks until the current frame is read.
+   /// Copies of the animation each get a clone of the stream. Edits through getCurrentFrameSpriteMutable
+   /// only last until the frame changes.
+   ///
+   /// @param stream - Frame source, nullptr goes back to the frames vector
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setStream(std::shared_ptr<FrameStream> stream);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getStream
+   ///
+   /// @return Stream the frames are played from, nullptr if the animation is held in memory
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::shared_ptr<FrameStream>& getStream() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationArchive.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Single file holding every animation of a printable, read by index
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONARCHIVE_H
+#define ANIMATIONARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationArchive
+///
+/// Packs every animation of a printable into one file for shipping, instead of a directory tree with a file
+/// per frame. The frames are stored back to back in the text frame format, each optionally compressed with
+/// a small LZ77 coder, followed by an index and a fixed size footer:
+///
+/// Frames: frame text or compressed frame text
+/// Index: per animation its name length, name and frame count, then one FrameEntry per frame
+/// Footer: index offset, index size, animation count, magic "LAEP", format version
+///
+/// Opening reads the footer and index only. Each frame is then one pread of its stored bytes, so frames can
+/// be read from any thread in any order. Files are written in native byte order, the magic doubles as a
+/// byte order check.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationArchive
+{
+public:
+   static constexpr const char* EXTENSION = ".pack";
+   static constexpr uint32_t    VERSION   = 1;
+
+   struct FrameEntry
+   {
+      uint64_t offset;     // Byte offset of the stored frame in the archive
+      uint32_t storedSize; // Bytes stored, less than size when the frame is compressed
+      uint32_t size;       // Bytes of frame text
+      float    duration;
+      int32_t  layer;
+   };
+
+   struct Footer
+   {
+      uint64_t indexOffset;
+      uint32_t indexSize;
+      uint32_t animationCount;
+      char     magic[4];
+      uint32_t version;
+   };
+
+   struct AnimationEntry
+   {
+      std::string             name;
+      std::vector<FrameEntry> frames;
+   };
+
+   struct FrameText
+   {
+      std::string text;
+      float       duration;
+      int32_t     layer;
+   };
+
+   struct AnimationText
+   {
+      std::string            name;
+      std::vector<FrameText> frames;
+   };
+
+private:
+   int                         m_fileDescriptor;
+   std::vector<AnimationEntry> m_animations;
+
+public:
+   AnimationArchive();
+   AnimationArchive(const std::string fileLocation);
+   ~AnimationArchive();
+
+   AnimationArchive(const AnimationArchive&)            = delete;
+   AnimationArchive& operator=(const AnimationArchive&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn open
+   ///
+   /// Reads the footer and index and keeps the file open for readFrame. Any previously opened archive is
+   /// closed first.
+   ///
+   /// @param fileLocation - Path of the archive
+   /// @return True if the archive was opened and its index is valid
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool open(const std::string fileLocation);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn close
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void close();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isOpen
+   ///
+   /// @return True if a valid archive is open
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isOpen() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getAnimations
+   ///
+   /// @return Index of the open archive, empty if nothing is open
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<AnimationEntry>& getAnimations() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn findAnimation
+   ///
+   /// @param name - Animation name
+   /// @return Index entry of the animation, nullptr if the archive has none by that name
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const AnimationEntry* findAnimation(const std::string& name) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readFrame
+   ///
+   /// Reads a frame's stored bytes with a single pread and decompresses them. Safe to call concurrently.
+   ///
+   /// @param entry - Frame entry from getAnimations
+   /// @param text - Receives the frame text
+   /// @return True if the frame was read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool readFrame(const FrameEntry& entry, std::string& text) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn write
+   ///
+   /// Frames are compressed concurrently on the loader ThreadPool, a frame is only stored compressed when
+   /// that makes it smaller. Written to a temporary file first and renamed, so a reader never opens a half
+   /// written archive.
+   ///
+   /// @param fileLocation - Path of the archive
+   /// @param animations - Animations to pack, frames in play order
+   /// @param compress - Compress frames
+   /// @return True if the archive was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool write(const std::string fileLocation, const std::vector<AnimationText>& animations,
+                     const bool compress);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn compress
+   ///
+   /// LZ77 with a 64 KiB window: literal runs and back references packed behind one token byte each
+   ///
+   /// @param data - Bytes to compress
+   /// @param size - Number of bytes
+   /// @param compressed - Receives the compressed bytes
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void compress(const char* data, const size_t size, std::string& compressed);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn decompress
+   ///
+   /// @param data - Bytes written by compress
+   /// @param size - Number of compressed bytes
+   /// @param decompressed - Receives the original bytes, must already be sized to their count
+   /// @return False if the data is corrupt or does not decompress to exactly decompressed.size() bytes
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool decompress(const char* data, const size_t size, std::string& decompressed);
+};
+
+#endif
@@ -0,0 +1,165 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationClock.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Schedules animation frame changes and reports which printables changed frame
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONCLOCK_H
+#define ANIMATIONCLOCK_H
+
+#include "Animation.h"
+#include "Printable.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationClock
+///
+/// Keeps every active animation in a contiguous table together with the clock time its frame timer was last
+/// synced and the clock time its frame next changes. Wake times live in a min-heap, so each refresh only
+/// touches the animations that are due; sleeping animations are not stepped until their frame actually
+/// changes. NcursesWindow runs this before it rasterizes anything, so stepping and drawing are separate
+/// phases. Animations stay in the table between refreshes; the window only re-registers them when one starts
+/// or stops playing, is shown or hidden, or is moved from outside the clock.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationClock
+{
+private:
+   //////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @class WakeEvent
+   ///
+   /// Heap entry. Stale entries (slot reused or rescheduled) are skipped by comparing the generation.
+   //////////////////////////////////////////////////////////////////////////////////////////////////////////
+   struct WakeEvent
+   {
+      double   wakeTime;
+      size_t   slot;
+      uint32_t generation;
+   };
+
+   double   m_now;
+   uint32_t m_nextGeneration;
+
+   // Animation table, one entry per tracked animation in each array
+   std::vector<Animation*> m_animations;
+   std::vector<Printable*> m_owners;
+   std::vector<double>     m_syncTimes;
+   std::vector<double>     m_wakeTimes;
+   std::vector<size_t>     m_frameIndices;
+   std::vector<uint64_t>   m_timingVersions;
+   std::vector<uint32_t>   m_generations;
+   std::vector<uint8_t>    m_seen;
+
+   std::unordered_map<Animation*, size_t> m_slots;
+   std::vector<WakeEvent>                 m_wakeHeap;
+   std::vector<Printable*>                m_changedPrintables;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn wakesLater
+   ///
+   /// @param a - First heap entry
+   /// @param b - Second heap entry
+   /// @return True if a wakes after b, keeps the earliest wake time on top of the heap
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool wakesLater(const WakeEvent& a, const WakeEvent& b);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn schedule
+   ///
+   /// Computes when the animation in the slot next changes frame and pushes it onto the heap
+   ///
+   /// @param slot - Table index of the animation
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void schedule(const size_t slot);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn sync
+   ///
+   /// Hands the time elapsed since the last sync to the animation, stepping any frames that ran out
+   ///
+   /// @param slot - Table index of the animation
+   /// @return True if the current frame changed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool sync(const size_t slot);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn removeSlot
+   ///
+   /// @param slot - Table index to remove, the last entry is swapped into its place
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void removeSlot(const size_t slot);
+
+public:
+   AnimationClock();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clear
+   ///
+   /// Forgets every tracked animation
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clear();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn beginTracking
+   ///
+   /// Starts re-registering the active animations, track must then be called for every playing animation
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void beginTracking();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn track
+   ///
+   /// Marks an animation as active. An animation already in the table is only rescheduled if its timing
+   /// version changed, e.g. its frames were replaced or it was stepped by hand.
+   ///
+   /// @param owner - Printable the animation belongs to, reported back if its frame changes
+   /// @param animation - Playing animation to schedule
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void track(Printable* owner, Animation* animation);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn endTracking
+   ///
+   /// Drops every animation not tracked since beginTracking. They are not dereferenced since their printable
+   /// may already be gone.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void endTracking();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn advance
+   ///
+   /// Moves the clock forward and steps only the animations whose next frame change is due
+   ///
+   /// @param deltaTime - Time since the last refresh
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void advance(const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getChangedPrintables
+   ///
+   /// @return Printables whose current frame changed during the last advance
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<Printable*>& getChangedPrintables() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTimeUntilNextChange
+   ///
+   /// @return Seconds until the earliest scheduled frame change, infinity if nothing is scheduled
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float getTimeUntilNextChange();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn size
+   ///
+   /// @return Number of animations in the table
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t size() const;
+};
+
+#endif
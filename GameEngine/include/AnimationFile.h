@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationFile.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Compiled binary animation file, memory mapped for loading
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONFILE_H
+#define ANIMATIONFILE_H
+
+#include "Frame.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationFile
+///
+/// Read only view of a compiled animation. The file is a header, a table with one entry per frame and
+/// every frame's cells packed back to back:
+///
+/// Header: magic "LAEA", format version, frame count, total cell count
+/// Frame table: duration, layer, index of the frame's first cell, cell count
+/// Cells: x, y, character, text RGB, background RGB, attributes
+///
+/// The file is mmap'ed and the header, frame table and cells are read in place, nothing is parsed or
+/// copied until a Frame is built from it. Files are written in native byte order by write, the magic
+/// doubles as a byte order check.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationFile
+{
+public:
+   static constexpr const char* FILE_NAME = "frames.bin";
+   static constexpr uint32_t    VERSION   = 1;
+
+   struct Header
+   {
+      char     magic[4];
+      uint32_t version;
+      uint32_t frameCount;
+      uint32_t cellCount;
+   };
+
+   struct FrameEntry
+   {
+      float    duration;
+      int32_t  layer;
+      uint32_t firstCell;
+      uint32_t cellCount;
+   };
+
+   struct Cell
+   {
+      int32_t  x;
+      int32_t  y;
+      uint32_t character;
+      int16_t  textR;
+      int16_t  textG;
+      int16_t  textB;
+      int16_t  backgroundR;
+      int16_t  backgroundG;
+      int16_t  backgroundB;
+      uint32_t attributes;
+   };
+
+private:
+   void*             m_mapping;
+   size_t            m_mappingSize;
+   const Header*     m_header;
+   const FrameEntry* m_frameTable;
+   const Cell*       m_cells;
+
+public:
+   AnimationFile();
+   AnimationFile(const std::string fileLocation);
+   ~AnimationFile();
+
+   AnimationFile(const AnimationFile&)            = delete;
+   AnimationFile& operator=(const AnimationFile&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn open
+   ///
+   /// Maps the file and checks its header and tables. Any previously opened file is closed first.
+   ///
+   /// @param fileLocation - Path of the compiled animation
+   /// @return True if the file was mapped and is a valid animation file
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool open(const std::string fileLocation);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn close
+   ///
+   /// Unmaps the file, pointers returned by getCells become invalid
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void close();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isOpen
+   ///
+   /// @return True if a valid file is mapped
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isOpen() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrameCount
+   ///
+   /// @return Number of frames in the file, 0 if nothing is open
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getFrameCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrameEntry
+   ///
+   /// @param index - Index of the frame, must be less than getFrameCount
+   /// @return Frame table entry, read in place from the mapping
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const FrameEntry& getFrameEntry(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getCells
+   ///
+   /// @param index - Index of the frame, must be less than getFrameCount
+   /// @return First of the frame's getFrameEntry(index).cellCount cells, read in place from the mapping
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const Cell* getCells(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrame
+   ///
+   /// @param index - Index of the frame, must be less than getFrameCount
+   /// @return Frame built straight from the mapped cells
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   Frame getFrame(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn releaseFrame
+   ///
+   /// Lets the kernel drop the mapped pages that only hold this frame's cells, they are read from the file
+   /// again if the frame is used later. Keeps a streamed animation's resident memory bounded.
+   ///
+   /// @param index - Index of the frame, must be less than getFrameCount
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void releaseFrame(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn write
+   ///
+   /// Compiles frames into a binary animation file. Written to a temporary file first and renamed, so a
+   /// reader never maps a half written file.
+   ///
+   /// @param fileLocation - Path of the compiled animation
+   /// @param frames - Frames to compile, delta frames are not supported
+   /// @return True if the file was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool write(const std::string fileLocation, const std::vector<Frame>& frames);
+};
+
+#endif
@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationManifest.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Per animation index of frame files and their metadata
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONMANIFEST_H
+#define ANIMATIONMANIFEST_H
+
+#include "Frame.h"
+#include "Position.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationManifest
+///
+/// Lists an animation's frame files in play order with what is needed to know the animation without
+/// opening them. Stored as text next to the frames:
+///
+/// First line: manifest,version,frame count
+/// One line per frame: file name,duration,layer,min x,min y,max x,max y,content hash
+///
+/// The bounding box covers the frame's pixels, an empty frame has max below min. The content hash is a
+/// 64 bit FNV-1a of the frame file written as hex, used to check a frame file is the one the manifest
+/// describes.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationManifest
+{
+public:
+   static constexpr const char* FILE_NAME = "manifest.txt";
+   static constexpr int         VERSION   = 1;
+
+   struct FrameInfo
+   {
+      std::string fileName;
+      float       duration;
+      int         layer;
+      Position    minPosition;
+      Position    maxPosition;
+      uint64_t    hash;
+   };
+
+private:
+   std::vector<FrameInfo> m_frames;
+
+public:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn read
+   ///
+   /// @param fileLocation - Path of the manifest
+   /// @return True if the manifest was read, false if it is missing or malformed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool read(const std::string fileLocation);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn write
+   ///
+   /// Written to a temporary file first and renamed, so a reader never sees a half written manifest
+   ///
+   /// @param fileLocation - Path of the manifest
+   /// @return True if the manifest was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool write(const std::string fileLocation) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn addFrame
+   ///
+   /// @param info - Next frame in play order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void addFrame(const FrameInfo& info);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrames
+   ///
+   /// @return Frames in play order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<FrameInfo>& getFrames() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrameCount
+   ///
+   /// @return Number of frames
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getFrameCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTotalDuration
+   ///
+   /// @return Duration of one cycle through the animation in seconds
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float getTotalDuration() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn describeFrame
+   ///
+   /// @param fileName - Name of the frame file within the animation directory
+   /// @param frame - Frame the file holds
+   /// @param hash - Content hash of the file (see hash)
+   /// @return Manifest entry for the frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static FrameInfo describeFrame(const std::string fileName, const Frame& frame, const uint64_t hash);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hash
+   ///
+   /// @param data - Bytes to hash
+   /// @param size - Number of bytes
+   /// @return 64 bit FNV-1a hash of the bytes
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static uint64_t hash(const char* data, const size_t size);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hashFile
+   ///
+   /// @param fileLocation - File to hash
+   /// @param fileHash - Receives the hash of the file's contents
+   /// @return True if the file could be read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool hashFile(const std::string fileLocation, uint64_t& fileHash);
+};
+
+#endif
@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationSheet.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Text animation format holding every frame of an animation in one file
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONSHEET_H
+#define ANIMATIONSHEET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationSheet
+///
+/// Sprite sheet of an animation: its text frames concatenated in play order into a single file, so the
+/// whole animation is one open and one sequential read instead of one per frame.
+///
+/// First line: sheet,version,frame count
+/// Per frame: a line frame,byte count followed by that many bytes holding the frame in the text frame format
+///
+/// The byte counts let a reader split the records without parsing them, or skip over them to build an index.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationSheet
+{
+public:
+   static constexpr const char* FILE_NAME = "sheet.txt";
+   static constexpr int         VERSION   = 1;
+
+   struct Record
+   {
+      uint64_t    offset;     // Byte offset of the frame text in the sheet
+      size_t      size;       // Byte count of the frame text
+      std::string headerLine; // First line of the frame text, duration,layer
+   };
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn read
+   ///
+   /// Reads the whole sheet in one pass
+   ///
+   /// @param fileLocation - Path of the sheet
+   /// @param buffer - Receives the file contents
+   /// @param frames - Receives the text of every frame in play order, pointing into buffer
+   /// @return True if the sheet was read, false if it is missing or malformed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool read(const std::string fileLocation, std::vector<char>& buffer,
+                    std::vector<std::string_view>& frames);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readIndex
+   ///
+   /// Reads only the record lines and each frame's first line, seeking over the frame text
+   ///
+   /// @param fileLocation - Path of the sheet
+   /// @param records - Receives one record per frame in play order
+   /// @return True if the sheet was read, false if it is missing or malformed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool readIndex(const std::string fileLocation, std::vector<Record>& records);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn write
+   ///
+   /// Written to a temporary file first and renamed, so a reader never sees a half written sheet
+   ///
+   /// @param fileLocation - Path of the sheet
+   /// @param frames - Text of every frame in play order
+   /// @return True if the sheet was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool write(const std::string fileLocation, const std::vector<std::string>& frames);
+};
+
+#endif
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationWatcher.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Hot reload of animations edited on disk while the game runs
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMATIONWATCHER_H
+#define ANIMATIONWATCHER_H
+
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AnimationWatcher
+///
+/// Opt-in hot reload for art iteration. A background thread watches src/Animations with inotify and, once
+/// the writes to a directory settle, re-parses only the text frame files that changed. Added, removed or
+/// renamed frames and AnimationSheet edits reload the whole animation instead.
+///
+/// The game loop calls applyReloads between ticks, which swaps the new frames into every live Animation of
+/// a displayed printable named after the entity. Only the cells of the replaced sprites are invalidated.
+/// A live animation whose frame count no longer matches a partial reload is handed back to the watcher
+/// thread and swapped once it was loaded whole, frames are never parsed on the main thread. Streamed
+/// animations are skipped, their frames are read from disk as they play anyway.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AnimationWatcher
+{
+public:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn start
+   ///
+   /// Starts watching src/Animations, does nothing if already watching
+   ///
+   /// @return True if the watcher is running
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool start();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn stop
+   ///
+   /// Stops the watcher thread, reloads it already parsed are dropped
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void stop();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isRunning
+   ///
+   /// @return True if the watcher is running
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isRunning();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn applyReloads
+   ///
+   /// Swaps reloaded frames into the live animations. Called on the main thread between ticks, returns at
+   /// once when nothing was reloaded.
+   ///
+   /// @return Number of animations updated
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static size_t applyReloads();
+};
+
+#endif
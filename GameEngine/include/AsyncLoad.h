@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AsyncLoad.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Handle to a printable being loaded in the background
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASYNCLOAD_H
+#define ASYNCLOAD_H
+
+#include "Animation.h"
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class AsyncLoad
+///
+/// Returned by the PrintableFactory load*Async functions. The animations are parsed on the loader
+/// ThreadPool, everything that touches ncurses or the InputHandler (building the printable, adding it to its
+/// NcursesWindow, registering buttons) is left for the completion step, which only ever runs on the main
+/// thread: the game loop completes every pending load once per frame through
+/// PrintableFactory::completePendingLoads, or a state can call poll or wait itself.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T> class AsyncLoad
+{
+public:
+   using Attach   = std::function<std::shared_ptr<T>(std::vector<Animation>)>;
+   using OnLoaded = std::function<void(std::shared_ptr<T>)>;
+
+private:
+   std::string                         m_name;
+   std::future<std::vector<Animation>> m_animations;
+   Attach                              m_attach;
+   OnLoaded                            m_onLoaded;
+   std::shared_ptr<T>                  m_printable;
+   bool                                m_done;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn complete
+   ///
+   /// Takes the parsed animations, attaches the printable and runs the onLoaded callback. If the background
+   /// parse failed the load finishes with no printable.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void complete()
+   {
+      m_done = true;
+      try
+      {
+         m_printable = m_attach(m_animations.get());
+      }
+      catch (const std::exception& e)
+      {
+         std::cerr << "Failed to load '" << m_name << "': " << e.what() << std::endl;
+         return;
+      }
+
+      if (m_onLoaded)
+         m_onLoaded(m_printable);
+   }
+
+public:
+   AsyncLoad(const std::string name, std::future<std::vector<Animation>> animations, Attach attach,
+             OnLoaded onLoaded)
+   {
+      m_name       = name;
+      m_animations = std::move(animations);
+      m_attach     = std::move(attach);
+      m_onLoaded   = std::move(onLoaded);
+      m_done       = false;
+   }
+
+   AsyncLoad(const AsyncLoad&)            = delete;
+   AsyncLoad& operator=(const AsyncLoad&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isReady
+   ///
+   /// @return True once the animations are parsed and the load can complete without blocking
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isReady() const
+   {
+      return m_done || m_animations.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isDone
+   ///
+   /// @return True once the load completed or was cancelled
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isDone() const { return m_done; }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn poll
+   ///
+   /// Completes the load if the animations are parsed, never blocks. Main thread only.
+   ///
+   /// @return The loaded printable, nullptr while still loading
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   std::shared_ptr<T> poll()
+   {
+      if (!m_done && isReady())
+         complete();
+
+      return m_printable;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn wait
+   ///
+   /// Blocks until the animations are parsed and completes the load. Main thread only.
+   ///
+   /// @return The loaded printable, nullptr if the load failed or was cancelled
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   std::shared_ptr<T> wait()
+   {
+      if (!m_done)
+         complete();
+
+      return m_printable;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn cancel
+   ///
+   /// Drops the load if it has not completed yet, the printable is never attached and onLoaded never runs.
+   /// The background parse still finishes and its result is thrown away.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void cancel() { m_done = true; }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getPrintable
+   ///
+   /// @return The loaded printable, nullptr until the load completes
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   std::shared_ptr<T> getPrintable() const { return m_printable; }
+};
+
+#endif
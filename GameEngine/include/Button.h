@@ -12,8 +12,10 @@
 #ifndef BUTTON_H
 #define BUTTON_H
 
+#include "TextLabel.h"
 #include "UIElement.h"
 #include <functional>
+#include <string>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,9 +27,11 @@ class Button : public UIElement
 {
 private:
    std::function<void()> m_function;
-   std::vector<RGB>      m_originalBackgroundColors;
-   std::vector<Position> m_originalPositions;
-   bool                  m_isHighlighted;
+
+   // Text drawn by setText, the sprite keeps the button's art until the first call
+   TextLabel           m_label;
+   bool                m_hasLabel;
+   std::vector<size_t> m_pinnedCells; // Pixels colored by setTextColors, highlighting leaves them alone
 
    // Automatic highlighting configuration
    bool m_autoHighlightEnabled;
@@ -36,11 +40,15 @@ private:
    RGB  m_selectedColor;
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   /// @fn storeOriginalColors
+   /// @fn applyLabel
+   ///
+   /// Writes the measured label into the sprite. Only rebuilt cells drop setTextColors colors and refresh
+   /// the bounds.
    ///
-   /// Stores the original background colors of all pixels for unhighlighting
+   /// @param change - What the measured label changes
+   /// @return True if the button changed size
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   void storeOriginalColors();
+   bool applyLabel(const LabelChange change);
 
 public:
    virtual ~Button();
@@ -79,26 +87,66 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setText
    ///
-   /// Sets the button text and wraps the outline around the new text
+   /// Sets the button text and wraps the outline around the new text, or leaves it borderless after
+   /// setBorder(false). Text of the same size rewrites only the characters that changed, in place.
    /// @param text - the new text to display on the button
+   /// @return True if the button changed size and locked positions need updating
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool setText(const std::string& text);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getText
+   ///
+   /// @return the text set by setText
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::string& getText() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setTextColors
+   ///
+   /// Colors one character of the text. The colors last until the text is laid out again and are kept
+   /// through highlighting.
+   /// @param column - column of the character in its line
+   /// @param row - line of the character
+   /// @param textColor - RGB color of the character
+   /// @param backgroundColor - RGB color behind the character
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   void setText(std::string text);
+   void setTextColors(const size_t column, const size_t row, const RGB& textColor,
+                      const RGB& backgroundColor);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setBorder
+   ///
+   /// Shows or hides the outline around the text set by setText
+   ///
+   /// @param enabled - Whether to enable or disable the border
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setBorder(bool enabled) override;
+   using UIElement::setBorder;
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn highlight
    ///
-   /// Changes all pixels' background colors to the specified RGB value
-   /// @param rgbValue - the RGB color to apply to all pixel backgrounds
+   /// Draws the button with the specified background color, the sprite's pixels are left unchanged
+   /// @param rgbValue - the RGB color drawn behind the button
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void highlight(RGB rgbValue);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn unhighlight
    ///
-   /// Restores all pixels' background colors to their original values
+   /// Draws the button with its pixels' own background colors again
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void unhighlight();
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn keepsOwnBackground
+   ///
+   /// @param pixelIndex - Index of a pixel in the current sprite
+   /// @return True if setTextColors colored the pixel
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool keepsOwnBackground(const size_t pixelIndex) const override;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setAutoHighlightEnabled
    ///
@@ -36,17 +36,11 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn initCurse
    ///
-   /// Initializes ncurses and all of its settings
+   /// Initializes ncurses and all of its settings. While replaying, the screen is a headless one drawing into
+   /// /dev/null instead of the terminal.
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    static void initCurse();
 
-   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   /// @fn getUserInput
-   ///
-   /// @return the users input in an integer converted to a char
-   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   static char getUserInput();
-
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn closeCurseWindow
    ///
@@ -63,6 +57,25 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    static void refreshDisplay(float deltaTime);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTimeUntilNextChange
+   ///
+   /// Lets the game loop sleep until something on screen actually needs redrawn
+   ///
+   /// @return Seconds until the earliest scheduled animation frame change across all windows, zero if a
+   /// redraw is already pending, infinity if nothing is animating
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static float getTimeUntilNextChange();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hashFrameBuffers
+   ///
+   /// Fingerprint of everything drawn, used to check replayed frames against a recording
+   ///
+   /// @return Hash of the position and frame buffer of every window, in window order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static uint64_t hashFrameBuffers();
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn removeWindow
    ///
@@ -13,21 +13,31 @@
 #define FRAME_H
 
 #include "Sprite.h"
+#include <vector>
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @class Frame
 ///
 /// Holds a sprite and a duration (in seconds). Used in an Animation
+///
+/// A frame is either a keyframe holding its full sprite, or a delta frame holding only the cells that
+/// differ from the frame before it. Delta frames keep the sprite's anchor and layer but no pixels, see
+/// Animation::encodeDeltas.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class Frame
 {
 private:
    Sprite m_sprite;
    float  m_durationInSeconds;
+   bool   m_keyframe;
+
+   // Delta from the previous frame, only used when this is not a keyframe
+   std::vector<Pixel>    m_changedPixels;
+   std::vector<Position> m_clearedPositions;
 
 public:
    Frame();
-   Frame(const Sprite sprite, const float duration);
+   Frame(Sprite sprite, const float duration);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn getDuration
@@ -57,6 +67,37 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void setSprite(const Sprite sprite);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setDelta
+   ///
+   /// Turns this frame into a delta frame. The sprite's pixels are released, its anchor and layer are kept.
+   ///
+   /// @param changedPixels - Pixels that were added or changed since the previous frame
+   /// @param clearedPositions - Positions that held a pixel in the previous frame but not in this one
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setDelta(const std::vector<Pixel> changedPixels, const std::vector<Position> clearedPositions);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isKeyframe
+   ///
+   /// @return True if the sprite holds every pixel of this frame, false for a delta frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isKeyframe() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getChangedPixels
+   ///
+   /// @return Pixels added or changed since the previous frame, empty for a keyframe
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<Pixel>& getChangedPixels() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getClearedPositions
+   ///
+   /// @return Positions emptied since the previous frame, empty for a keyframe
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<Position>& getClearedPositions() const;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn displace
    ///
@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file FrameStream.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Reads an animation's frames ahead of playback on a prefetch thread
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FRAMESTREAM_H
+#define FRAMESTREAM_H
+
+#include "Frame.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class FrameStream
+///
+/// Frame source for animations too long to keep in memory. A prefetch thread reads the frames that follow the
+/// playhead into a window, wrapping around to the first frame after the last, until the window holds every
+/// frame or its decoded size reaches the memory cap. Frames leave the window as the playhead moves past
+/// them, so memory stays bounded by the cap whatever the length of the animation.
+///
+/// When playback asks for a frame the prefetcher has not read yet, that is an underrun: the newest frame
+/// already read before it is handed out instead, or nothing, and the prefetcher skips ahead to the playhead.
+///
+/// The prefetch thread starts when the first frame is taken, so a stream that is never played reads nothing.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class FrameStream
+{
+public:
+   using ReadFrame = std::function<Frame(size_t)>;
+
+private:
+   ReadFrame                   m_readFrame;
+   std::shared_ptr<std::mutex> m_readMutex; // Shared with clones, readFrame never runs concurrently
+   size_t                      m_frameCount;
+
+   // Frames are numbered by sequence, frame index = sequence % frame count, so the window never goes back
+   mutable std::mutex      m_mutex;
+   std::condition_variable m_frameReady;
+   std::condition_variable m_spaceAvailable;
+   std::deque<Frame>       m_window;        // Frames m_windowStart up to m_nextRead
+   uint64_t                m_windowStart;   // Sequence of the first frame not yet handed out
+   uint64_t                m_nextRead;      // Sequence the prefetcher reads next
+   uint64_t                m_generation;    // Bumped when the prefetcher skips ahead, drops its read
+   size_t                  m_bufferedBytes;
+   size_t                  m_memoryCap;
+   size_t                  m_underrunCount;
+   bool                    m_stopping;
+   std::thread             m_prefetcher;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn prefetchLoop
+   ///
+   /// Reads frames into the window until the stream is destroyed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void prefetchLoop();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn frameBytes
+   ///
+   /// @param frame - Decoded frame
+   /// @return Memory held by the frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static size_t frameBytes(const Frame& frame);
+
+public:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @param frameCount - Number of frames in the animation
+   /// @param readFrame - Reads one frame by index, called on the prefetch thread only
+   /// @param memoryCap - Bytes of decoded frames to buffer ahead, at least one frame is always buffered
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   FrameStream(const size_t frameCount, ReadFrame readFrame, const size_t memoryCap);
+   ~FrameStream();
+
+   FrameStream(const FrameStream&)            = delete;
+   FrameStream& operator=(const FrameStream&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn takeFrame
+   ///
+   /// Moves the playhead forward to index and hands out its frame. Frames between the old and new playhead
+   /// are dropped, going back to an earlier index means going forward around the whole animation.
+   ///
+   /// @param index - Index of the frame to play
+   /// @param frame - Receives the frame, or the newest buffered frame before it on an underrun
+   /// @param wait - Block until the frame is read instead of counting an underrun
+   /// @return False if no frame was handed out
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool takeFrame(const size_t index, Frame& frame, const bool wait);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clone
+   ///
+   /// @return New stream reading the same frames from the first one with the same memory cap, for copies of
+   /// a streamed animation which each need their own playhead
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   std::shared_ptr<FrameStream> clone() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getFrameCount
+   ///
+   /// @return Number of frames in the animation
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getFrameCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setMemoryCap
+   ///
+   /// @param memoryCap - Bytes of decoded frames to buffer ahead, a lower cap applies as frames are played
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setMemoryCap(const size_t memoryCap);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getMemoryCap
+   ///
+   /// @return Bytes of decoded frames buffered ahead at most
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getMemoryCap() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getBufferedBytes
+   ///
+   /// @return Bytes of decoded frames currently buffered
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getBufferedBytes() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getBufferedFrameCount
+   ///
+   /// @return Number of frames currently buffered
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getBufferedFrameCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getUnderrunCount
+   ///
+   /// @return Number of times a frame was not read in time for playback
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getUnderrunCount() const;
+};
+
+#endif
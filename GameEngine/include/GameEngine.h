@@ -10,17 +10,31 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Animation.h"
+#include "AnimationArchive.h"
+#include "AnimationClock.h"
+#include "AnimationFile.h"
+#include "AnimationManifest.h"
+#include "AnimationSheet.h"
+#include "AnimationWatcher.h"
+#include "AsyncLoad.h"
 #include "Button.h"
 #include "Camera.h"
 #include "Display.h"
 #include "Entity.h"
 #include "Frame.h"
+#include "FrameStream.h"
 #include "GameObject.h"
 #include "GameState.h"
+#include "HitGrid.h"
 #include "InputHandler.h"
+#include "InputQueue.h"
+#include "InputRecorder.h"
+#include "InputThread.h"
+#include "InstancedPrintable.h"
 #include "Menu.h"
 #include "NcursesMenu.h"
 #include "Parameters.h"
+#include "ParticleEmitter.h"
 #include "Pixel.h"
 #include "Position.h"
 #include "Printable.h"
@@ -28,6 +42,10 @@
 #include "RGB.h"
 #include "Slider.h"
 #include "Sprite.h"
+#include "SpscRing.h"
+#include "TerminalDecoder.h"
+#include "TextLabel.h"
+#include "ThreadPool.h"
 #include "UIElement.h"
 #include <locale.h>
 #include <ncursesw/form.h>
@@ -43,15 +61,28 @@
 class GameEngine
 {
 private:
-   GameState* currentState;
+   GameState*              currentState;
+   TerminalDecoder         terminalDecoder; // Keeps escape sequences split between two frames' reads
+   std::vector<InputEvent> decodedInput;
 
    void exit();
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readInput
+   ///
+   /// Reads and decodes everything the terminal sent, drains the InputThread when running or takes the
+   /// replayed frame's events while replaying, into inputEvents and passes each one to the globalInputHandler
+   ///
+   /// @return True if anything was read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool readInput();
+
 public:
    GameEngine(GameState* initialState) : currentState(initialState)
    {
       Display::initCurse();
-      engineRunning = true;
+      terminalDecoder = TerminalDecoder(); // Its key codes are only known once ncurses has the terminal
+      engineRunning   = true;
       currentState->onEnter();
    }
 
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file HitGrid.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Screen-space grid of bounding boxes for mouse hit-testing
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HITGRID_H
+#define HITGRID_H
+
+#include "Position.h"
+#include <cstddef>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class HitGrid
+///
+/// Buckets the screen into fixed size cells, every cell lists the ids whose bounding box overlaps it. A
+/// lookup only returns the ids of one cell, so the cost of a mouse event no longer grows with the number of
+/// registered elements. Ids are kept in insertion order inside each cell, callers that insert in priority
+/// order get their candidates back in priority order.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class HitGrid
+{
+private:
+   struct Bounds
+   {
+      int minX;
+      int minY;
+      int maxX;
+      int maxY;
+   };
+
+   int                              m_cellWidth;
+   int                              m_cellHeight;
+   int                              m_columns;
+   int                              m_rows;
+   std::vector<std::vector<size_t>> m_cells;
+   std::vector<Bounds>              m_bounds; // Indexed by id, boxes of ids never inserted are empty
+   std::vector<size_t>              m_candidates;
+
+public:
+   HitGrid(const int cellWidth = 8, const int cellHeight = 4);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn reset
+   ///
+   /// Drops every id and resizes the grid to cover the screen
+   ///
+   /// @param screenWidth - Width of the screen in cells
+   /// @param screenHeight - Height of the screen in cells
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void reset(const int screenWidth, const int screenHeight);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn insert
+   ///
+   /// Adds an id to every cell its box overlaps, the parts of the box off the screen are ignored
+   ///
+   /// @param id - Caller defined id, ids should be small as the boxes are stored by id
+   /// @param minPosition - Top left corner of the box in screen coordinates
+   /// @param maxPosition - Bottom right corner of the box in screen coordinates, inclusive
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void insert(const size_t id, const Position minPosition, const Position maxPosition);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn query
+   ///
+   /// @param position - Screen position to look up
+   /// @return Ids whose box contains the position, in insertion order. Valid until the next query
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<size_t>& query(const Position position);
+};
+
+#endif
@@ -13,6 +13,8 @@
 #define INPUTHANDLER_H
 
 #include "Button.h"
+#include "HitGrid.h"
+#include "InputQueue.h"
 #include "Slider.h"
 #include <functional>
 #include <memory>
@@ -48,6 +50,13 @@ private:
    std::vector<std::shared_ptr<Button>> buttons;
    std::vector<std::shared_ptr<Slider>> sliders;
 
+   // Screen-space index of the sliders (ids first) and buttons (ids after the sliders), rebuilt lazily when
+   // elements are registered or uiLayoutVersion moves on
+   HitGrid       hitGrid;
+   bool          hitGridNeedsRebuilt;
+   unsigned long hitGridLayoutVersion;
+   Position      hitGridScreenSize;
+
    // Window focus management
    std::vector<std::shared_ptr<NcursesWindow>> inFocusedWindows;
    bool                                        contextsExplicitlyManaged;
@@ -127,6 +136,16 @@ private:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    bool isWindowInFocus(WINDOW* window) const;
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getCandidates
+   ///
+   /// Rebuilds the hit grid if the layout changed since it was built, then looks up the position
+   /// @param position - the screen position to check
+   /// @return ids of the sliders and buttons whose bounding box contains the position, sliders first and
+   ///         each kind in registration order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<size_t>& getCandidates(Position position);
+
 public:
    InputHandler();
 
@@ -203,11 +222,11 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn processInput
    ///
-   /// Main input processing function that handles all input types
-   /// @param userInput - the raw input character from ncurses
+   /// Main input processing function that handles all input types, called once per event of the frame
+   /// @param inputEvent - the key or mouse event read by the game loop
    /// @return true if the input was handled by a UI element, false otherwise
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   bool processInput(int userInput);
+   bool processInput(const InputEvent& inputEvent);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn clear
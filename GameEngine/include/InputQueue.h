@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputQueue.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Typed input events read during one frame, in arrival order
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include "Position.h"
+#include <ncurses.h>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @struct InputEvent
+///
+/// One key press or mouse event decoded by a TerminalDecoder, or replayed by the InputRecorder
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct InputEvent
+{
+   int                                   key;           // Same code getch gives, KEY_MOUSE for mouse events
+   Position                              mousePosition; // Screen cell of a mouse event
+   mmask_t                               buttonState;   // Mouse event bits (BUTTON1_PRESSED, ...), 0 for keys
+   mmask_t                               heldButtons;   // BUTTONn_PRESSED bit of every button held down
+   std::chrono::steady_clock::time_point timestamp;     // When the event was read
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isMouse
+   ///
+   /// @return True for mouse events
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isMouse() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isMotionOnly
+   ///
+   /// @return True for mouse events that only report a new position, no button transition
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isMotionOnly() const;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class InputQueue
+///
+/// Input events of the current frame, filled by the game loop before GameState::update and iterated by
+/// states instead of reading the single last key. Keys and button transitions are always kept. Mouse motion
+/// with no button held is coalesced, consecutive hover reports collapse into the newest one. Motion while a
+/// button is held is kept, so drag strokes keep every cell the terminal reported.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class InputQueue
+{
+private:
+   std::vector<InputEvent> m_events;
+   mmask_t                 m_heldButtons;
+
+public:
+   InputQueue();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn push
+   ///
+   /// Queues an event, tracks which buttons are held (heldButtons is filled in here) and coalesces hover
+   /// motion
+   ///
+   /// @param event - Key or mouse event
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void push(InputEvent event);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clear
+   ///
+   /// Drops the events of the previous frame, held buttons are remembered
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clear();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getEvents
+   ///
+   /// @return Events of the current frame in arrival order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<InputEvent>& getEvents() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getHeldButtons
+   ///
+   /// @return BUTTONn_PRESSED bit of every mouse button currently held down
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   mmask_t getHeldButtons() const;
+
+   std::vector<InputEvent>::const_iterator begin() const;
+   std::vector<InputEvent>::const_iterator end() const;
+   size_t                                  size() const;
+   bool                                    empty() const;
+};
+
+#endif
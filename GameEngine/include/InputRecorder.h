@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputRecorder.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Records the input the game loop sees and replays it with per frame framebuffer checks
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include "InputQueue.h"
+#include <cstddef>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class InputRecorder
+///
+/// Captures a session frame by frame: the frame's deltaTime, every event in inputEvents with its timestamp
+/// and a hash of all frame buffers once the frame is drawn. Replaying feeds the recorded events and frame
+/// times back to GameEngine::run instead of the terminal and compares each frame's hash with the recorded
+/// one, so interactive flows become repeatable benchmarks and rendering regression tests.
+///
+/// A replay runs at full speed by default, or paced like the recording in real time. The screen size and
+/// randomSeed of the recording are restored, and Display draws into /dev/null through a fixed terminal type,
+/// so a replay needs no terminal and can run headless in CI. While recording or replaying, GameEngine::run
+/// waits for background loads on the frame that started them so they land on the same frame in both.
+///
+/// The file is text, a header line "recording <version> <columns> <rows> <seed>" followed per frame by
+/// "frame <deltaTime> <hash> <event count>" and one "<microseconds> <key> <x> <y> <buttons>" line per event.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class InputRecorder
+{
+public:
+   static constexpr int VERSION = 1;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn startRecording
+   ///
+   /// Starts writing every frame to a file, call before the GameEngine is created
+   ///
+   /// @param path - File to write, replaced if it exists
+   /// @return True if the file could be opened
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool startRecording(const std::string& path);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn startReplay
+   ///
+   /// Loads a recording to play back instead of reading the terminal, call before the GameEngine is created
+   /// so the recorded screen size applies
+   ///
+   /// @param path - Recording to replay
+   /// @param realTime - Pace frames like the recording instead of running them back to back
+   /// @return True if the recording could be read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool startReplay(const std::string& path, const bool realTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn stop
+   ///
+   /// Closes the recording, or prints the replay summary to stderr. Call after ncurses has ended.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void stop();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isRecording
+   ///
+   /// @return True while recording
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isRecording();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isReplaying
+   ///
+   /// @return True while replaying
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isReplaying();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn beginFrame
+   ///
+   /// Replaying, moves to the next recorded frame and waits for its time in real time mode. Ends the engine
+   /// once the recording runs out.
+   ///
+   /// @param deltaTime - Measured time since the last frame
+   /// @return The recorded deltaTime while replaying, deltaTime otherwise
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static float beginFrame(const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readFrameInput
+   ///
+   /// Replaying, queues the events of the current frame
+   ///
+   /// @param queue - Queue of the current frame
+   /// @return True if the frame had any events
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool readFrameInput(InputQueue& queue);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn endFrame
+   ///
+   /// Called once the frame is drawn. Recording, writes the frame. Replaying, checks its framebuffer hash.
+   ///
+   /// @param events - Events the frame handled
+   /// @param deltaTime - deltaTime the frame ran with
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void endFrame(const InputQueue& events, const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getMismatchCount
+   ///
+   /// @return Number of replayed frames whose framebuffer hash differed from the recording
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static size_t getMismatchCount();
+};
+
+#endif
@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputThread.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Optional background thread that reads terminal input independently of the frame rate
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INPUTTHREAD_H
+#define INPUTTHREAD_H
+
+#include "InputQueue.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class InputThread
+///
+/// Opt-in replacement for reading input with getch once per frame. A background thread blocks on the tty,
+/// decodes keys and mouse reports with a TerminalDecoder as soon as they arrive, timestamps them and pushes
+/// them into a lock-free single producer, single consumer ring. The game loop drains the ring at the start
+/// of each frame, so a long frame delays when events are handled but no longer when they are read, and
+/// drag strokes keep every cell the terminal reported.
+///
+/// ncurses is not thread safe, so the thread never calls it, start builds its TerminalDecoder on the calling
+/// thread. While the thread runs it owns stdin and the game loop must not call getch.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class InputThread
+{
+public:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn start
+   ///
+   /// Starts reading the terminal, call after Display::initCurse. Does nothing if already running.
+   ///
+   /// @return True if the thread is running
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool start();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn stop
+   ///
+   /// Stops the thread, events not drained yet are dropped
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void stop();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isRunning
+   ///
+   /// @return True if the thread is running
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isRunning();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getWakeDescriptor
+   ///
+   /// @return File descriptor that polls readable while events wait to be drained, -1 if not running
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static int getWakeDescriptor();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn drain
+   ///
+   /// Moves every queued event into the frame's queue in arrival order. Main thread only.
+   ///
+   /// @param queue - Queue of the current frame
+   /// @return True if any event was drained
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool drain(InputQueue& queue);
+};
+
+#endif
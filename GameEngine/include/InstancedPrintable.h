@@ -0,0 +1,195 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InstancedPrintable.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Printable that draws many copies of one shared animation, each with its own position and timing
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INSTANCEDPRINTABLE_H
+#define INSTANCEDPRINTABLE_H
+
+#include "NcursesWindow.h"
+#include "Printable.h"
+#include <cstdint>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class InstancedPrintable
+///
+/// Holds a single animation and a compact set of per-instance arrays (position, frame index, frame timer
+/// and visibility). Every instance is drawn from the same frames, so thousands of identical sprites cost one
+/// copy of the animation. The shared animation should be authored at the origin; each instance is drawn
+/// with its position added to every pixel. Index arguments past getInstanceCount are ignored.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class InstancedPrintable : public Printable
+{
+private:
+   // Per-instance state, one entry per instance in each array
+   std::vector<int>     m_instanceX;
+   std::vector<int>     m_instanceY;
+   std::vector<size_t>  m_instanceFrame;
+   std::vector<float>   m_instanceTimer;
+   std::vector<uint8_t> m_instanceVisible;
+
+   // Where each instance was drawn last refresh, so it can be erased before redrawing
+   std::vector<int>    m_drawnX;
+   std::vector<int>    m_drawnY;
+   std::vector<size_t> m_drawnFrame;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn updateInstances
+   ///
+   /// Advances every instance's frame timer through the shared animation's frame durations
+   ///
+   /// @param deltaTime - Time since the last refresh
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void updateInstances(const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setSharedAnimation
+   ///
+   /// Makes an animation the one every instance draws from. Delta encoded frames are decoded to full
+   /// sprites, a streamed animation is rejected since its frames only exist one at a time.
+   ///
+   /// @param animation - Animation to share
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setSharedAnimation(const Animation& animation);
+
+public:
+   InstancedPrintable();
+   InstancedPrintable(const std::string printableName, const Animation animation, const bool visable,
+                      const bool moveableByCamera);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn addInstance
+   ///
+   /// @param position - Offset the shared animation is drawn at for this instance
+   /// @param startFrame - Frame the instance starts on, lets instances play out of phase
+   /// @return Index of the new instance
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t addInstance(const Position position, const size_t startFrame = 0);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn removeInstance
+   ///
+   /// Removes an instance by swapping the last instance into its slot. The last instance's index changes to
+   /// the removed index.
+   ///
+   /// @param index - Index of the instance to remove
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void removeInstance(const size_t index);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clearInstances
+   ///
+   /// Removes every instance
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clearInstances();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getInstanceCount
+   ///
+   /// @return Number of instances
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getInstanceCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setInstancePosition
+   ///
+   /// @param index - Index of the instance
+   /// @param position - New offset for the instance
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setInstancePosition(const size_t index, const Position position);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getInstancePosition
+   ///
+   /// @param index - Index of the instance
+   /// @return Offset of the instance
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   Position getInstancePosition(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn displaceInstance
+   ///
+   /// @param index - Index of the instance
+   /// @param dx - X axis difference
+   /// @param dy - Y axis difference
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void displaceInstance(const size_t index, const int dx, const int dy);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setInstanceFrame
+   ///
+   /// @param index - Index of the instance
+   /// @param frameIndex - Frame of the shared animation to show, timer restarts
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setInstanceFrame(const size_t index, const size_t frameIndex);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getInstanceFrame
+   ///
+   /// @param index - Index of the instance
+   /// @return Frame of the shared animation the instance is showing
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getInstanceFrame(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setInstanceVisability
+   ///
+   /// @param index - Index of the instance
+   /// @param visable - Sets the instance's visibility
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setInstanceVisability(const size_t index, const bool visable);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isInstanceVisable
+   ///
+   /// @param index - Index of the instance
+   /// @return Boolean indicating if the instance is drawn
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isInstanceVisable(const size_t index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn displace
+   ///
+   /// Displaces every instance
+   ///
+   /// @param dx - X axis difference
+   /// @param dy - Y axis difference
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void displace(const int dx, const int dy) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn drawToWindow
+   ///
+   /// Advances every instance and draws every visible instance in one pass over the arrays
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   /// @param deltaTime - Time since the last refresh
+   /// @return Always true, instances are never drawn through the window's sprite path
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool drawToWindow(NcursesWindow& window, const float deltaTime) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn eraseBatched
+   ///
+   /// Erases every instance where it was drawn last refresh
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void eraseBatched(NcursesWindow& window) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isBatched
+   ///
+   /// @return Always true, instances keep their own frame timers
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isBatched() const override;
+};
+
+#endif
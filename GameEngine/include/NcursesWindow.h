@@ -12,9 +12,11 @@
 #ifndef NCURSESWINDOW_H
 #define NCURSESWINDOW_H
 
+#include "AnimationClock.h"
 #include "Pixel.h"
 #include "Printable.h"
 #include <ncurses.h>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -47,6 +49,8 @@ private:
    int                                     m_paddingY;
    int                                     m_minWidth;
    int                                     m_minHeight;
+   AnimationClock                          m_animationClock;
+   unsigned long                           m_trackedAnimationVersion;
 
    // Sub-window support
    std::weak_ptr<NcursesWindow>                m_parentWindow;
@@ -113,6 +117,13 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void clearPrintables();
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getPrintables
+   ///
+   /// @return Printables contained in the window, not those of its sub-windows
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::vector<std::shared_ptr<Printable>>& getPrintables() const;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn refreshWindow
    ///
@@ -123,6 +134,14 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void refreshPrintables(const float deltaTime);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTimeUntilNextChange
+   ///
+   /// @return Seconds until an animation in this window or its sub-windows next changes frame. Zero if the
+   /// window has to be redrawn anyway, infinity if nothing is animating.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float getTimeUntilNextChange();
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn getWindow
    ///
@@ -239,6 +258,66 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void eraseSprite(const Sprite sprite, const bool isMoveableByCamera);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn printSpriteWithBackground
+   ///
+   /// Prints a printable's sprite with the printable's override background behind the pixels that do not
+   /// keep their own, without copying or changing the sprite
+   ///
+   /// @param sprite - sprite to print to window
+   /// @param printable - printable the sprite belongs to
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void printSpriteWithBackground(const Sprite& sprite, const Printable& printable);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn printSpriteAtOffset
+   ///
+   /// Prints a sprite translated by an offset without copying it. Used by printables that draw one shared
+   /// sprite at many positions.
+   ///
+   /// @param sprite - sprite to print to window
+   /// @param offsetX - X offset added to every pixel
+   /// @param offsetY - Y offset added to every pixel
+   /// @param isMoveableByCamera - bool to know if camera offsets are needed or not
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void printSpriteAtOffset(const Sprite& sprite, const int offsetX, const int offsetY,
+                            const bool isMoveableByCamera);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn eraseSpriteAtOffset
+   ///
+   /// @param sprite - sprite needed to be removed
+   /// @param offsetX - X offset the sprite was printed at
+   /// @param offsetY - Y offset the sprite was printed at
+   /// @param isMoveableByCamera - bool to know if camera offsets are needed or not
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void eraseSpriteAtOffset(const Sprite& sprite, const int offsetX, const int offsetY,
+                            const bool isMoveableByCamera);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn printCell
+   ///
+   /// Writes a glyph and text color into an existing frame buffer cell in place, keeping the cell's
+   /// background. Lets batched printables rasterize without building Pixel objects.
+   ///
+   /// @param x - X position of the cell
+   /// @param y - Y position of the cell
+   /// @param character - glyph to write
+   /// @param textColor - text color to write
+   /// @param isMoveableByCamera - bool to know if camera offsets are needed or not
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void printCell(const int x, const int y, const wchar_t character, const RGB& textColor,
+                  const bool isMoveableByCamera);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn eraseCell
+   ///
+   /// @param x - X position of the cell
+   /// @param y - Y position of the cell
+   /// @param isMoveableByCamera - bool to know if camera offsets are needed or not
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void eraseCell(const int x, const int y, const bool isMoveableByCamera);
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setBorderEnabled
    ///
@@ -362,5 +441,13 @@ public:
    /// @return true if this is a sub-window
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    bool isSubWindow() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hashFrameBuffer
+   ///
+   /// @param hash - Running FNV-1a hash to continue
+   /// @return hash extended with the window's screen position, size and every cell of its frame buffer
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   uint64_t hashFrameBuffer(uint64_t hash) const;
 };
 #endif
\ No newline at end of file
@@ -13,9 +13,11 @@
 #define PARAMETERS_H
 #include "Camera.h"
 #include "Entity.h"
+#include "InputQueue.h"
 #include "NcursesWindow.h"
 #include "UIElement.h"
 #include <panel.h>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -37,6 +39,34 @@ extern int  userInput;
 extern bool engineRunning;
 extern bool displayNeedsCleared;
 
+// Bumped whenever a UI element or window moves or changes shape, hit-testing indexes rebuild when it changes
+extern unsigned long uiLayoutVersion;
+
+// Bumped whenever an animation starts or stops playing, is shown or hidden, or has its frame or timer
+// changed from outside the animation clock. Windows only re-register animations with their clock when it
+// changes. Atomic since animations are also built on loader threads.
+extern std::atomic<unsigned long> animationTrackingVersion;
+
+// Every key and mouse event read this frame, in arrival order. userInput only holds the last key.
+extern InputQueue inputEvents;
+
+// Seeds random effects such as ParticleEmitters when nonzero so a recorded session replays the same frames,
+// 0 seeds each from std::random_device
+extern unsigned int randomSeed;
+
+// Longest the game loop sleeps while waiting for input or the next animation frame change
+extern int maxIdleSleepMilliseconds;
+
+// Cap on worker threads used to load animations in parallel (also limited by the number of cores)
+extern unsigned int maxLoaderThreads;
+
+// Default bytes of decoded frames a streamed animation buffers ahead of the playhead
+extern size_t maxStreamBufferBytes;
+
+// Loads packed AnimationArchives without checking the entity's directory tree for newer files, for hosts
+// that ship archives next to the text frames. An archive is always trusted when the tree is absent.
+extern bool trustAnimationArchives;
+
 extern InputHandler globalInputHandler;
 
 #endif
@@ -0,0 +1,243 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ParticleEmitter.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Printable that spawns, moves and draws short lived single cell particles (sparks, rain, etc.)
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PARTICLEEMITTER_H
+#define PARTICLEEMITTER_H
+
+#include "NcursesWindow.h"
+#include "Printable.h"
+#include "RGB.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class ParticleEmitter
+///
+/// Keeps particle state in structure-of-arrays form (position, velocity, lifetime, glyph and color index)
+/// and updates every particle in one batch per refresh. Particles are written straight into the window's
+/// frame buffer cells, no Pixel or Sprite objects are created. Add it to an NcursesWindow like any other
+/// printable.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class ParticleEmitter : public Printable
+{
+private:
+   // Particle state, one entry per live particle in each array
+   std::vector<float>   m_x;
+   std::vector<float>   m_y;
+   std::vector<float>   m_velocityX;
+   std::vector<float>   m_velocityY;
+   std::vector<float>   m_life;
+   std::vector<float>   m_maxLife;
+   std::vector<wchar_t> m_glyph;
+   std::vector<uint8_t> m_color;
+
+   // Cells written last refresh, erased before the next draw
+   std::vector<int> m_drawnX;
+   std::vector<int> m_drawnY;
+
+   // Emission settings
+   size_t             m_maxParticles;
+   Position           m_origin;
+   int                m_spawnWidth;
+   int                m_spawnHeight;
+   float              m_emissionRate;
+   float              m_emissionAccumulator;
+   float              m_minVelocityX;
+   float              m_maxVelocityX;
+   float              m_minVelocityY;
+   float              m_maxVelocityY;
+   float              m_gravityX;
+   float              m_gravityY;
+   float              m_minLifetime;
+   float              m_maxLifetime;
+   std::wstring       m_glyphs;
+   std::vector<RGB>   m_colors;
+   bool               m_colorByAge;
+   std::mt19937       m_random;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn spawnParticle
+   ///
+   /// Spawns one particle inside the spawn area using the emission settings
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void spawnParticle();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn removeParticle
+   ///
+   /// @param index - Index of the particle to remove, the last particle is swapped into its slot
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void removeParticle(const size_t index);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn randomRange
+   ///
+   /// @param min - Lowest value
+   /// @param max - Highest value
+   /// @return Uniform random value between min and max
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   float randomRange(const float min, const float max);
+
+public:
+   ParticleEmitter();
+   ParticleEmitter(const std::string printableName, const Position origin, const size_t maxParticles,
+                   const bool visable, const bool moveableByCamera);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn update
+   ///
+   /// Spawns particles for the emission rate, integrates velocity and gravity and removes expired
+   /// particles. Called by drawToWindow every refresh.
+   ///
+   /// @param deltaTime - Time since the last refresh
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void update(const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn burst
+   ///
+   /// @param count - Number of particles to spawn at once (explosions for example)
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void burst(const size_t count);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clearParticles
+   ///
+   /// Removes every live particle
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clearParticles();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getParticleCount
+   ///
+   /// @return Number of live particles
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getParticleCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setMaxParticles
+   ///
+   /// @param maxParticles - Cap on live particles, spawning stops while at the cap
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setMaxParticles(const size_t maxParticles);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setOrigin
+   ///
+   /// @param origin - Top left of the spawn area
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setOrigin(const Position origin);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getOrigin
+   ///
+   /// @return Top left of the spawn area
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const Position& getOrigin() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setSpawnArea
+   ///
+   /// @param width - Width of the spawn area (1 spawns from a single cell, screen width for rain)
+   /// @param height - Height of the spawn area
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setSpawnArea(const int width, const int height);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setEmissionRate
+   ///
+   /// @param particlesPerSecond - Continuous emission rate, 0 only spawns through burst
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setEmissionRate(const float particlesPerSecond);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setVelocityRange
+   ///
+   /// @param minX - Lowest starting X velocity in cells per second
+   /// @param maxX - Highest starting X velocity in cells per second
+   /// @param minY - Lowest starting Y velocity in cells per second
+   /// @param maxY - Highest starting Y velocity in cells per second
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setVelocityRange(const float minX, const float maxX, const float minY, const float maxY);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setGravity
+   ///
+   /// @param gravityX - X acceleration in cells per second squared
+   /// @param gravityY - Y acceleration in cells per second squared
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setGravity(const float gravityX, const float gravityY);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setLifetimeRange
+   ///
+   /// @param minSeconds - Shortest particle lifetime
+   /// @param maxSeconds - Longest particle lifetime
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setLifetimeRange(const float minSeconds, const float maxSeconds);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setGlyphs
+   ///
+   /// @param glyphs - Characters a new particle picks from at random
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setGlyphs(const std::wstring glyphs);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setColors
+   ///
+   /// @param colors - Text colors for particles (at most 256)
+   /// @param colorByAge - If true particles step through colors in order as they age, otherwise each
+   /// particle keeps one color picked at random
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setColors(const std::vector<RGB> colors, const bool colorByAge = false);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn displace
+   ///
+   /// Displaces the spawn area and every live particle
+   ///
+   /// @param dx - X axis difference
+   /// @param dy - Y axis difference
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void displace(const int dx, const int dy) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn drawToWindow
+   ///
+   /// Updates the particles and writes every live particle into the window
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   /// @param deltaTime - Time since the last refresh
+   /// @return Always true, particles are never drawn through the window's sprite path
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool drawToWindow(NcursesWindow& window, const float deltaTime) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn eraseBatched
+   ///
+   /// Erases the cells particles were written to last refresh
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void eraseBatched(NcursesWindow& window) override;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isBatched
+   ///
+   /// @return Always true, particles are stepped inside drawToWindow
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isBatched() const override;
+};
+
+#endif
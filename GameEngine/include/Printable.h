@@ -16,6 +16,8 @@
 #include <string>
 #include <vector>
 
+class NcursesWindow;
+
 // Forward declaration
 typedef struct _win_st WINDOW;
 
@@ -36,6 +38,8 @@ protected:
    bool                   m_moveableByCamera;
    std::vector<Sprite>    m_dirtySprites;
    WINDOW*                m_ncurseWindow;
+   bool                   m_backgroundOverridden; // Drawn with m_overrideBackground, the pixels keep theirs
+   RGB                    m_overrideBackground;
 
 public:
    Printable();
@@ -87,6 +91,36 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    virtual void displace(const int dx, const int dy);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn drawToWindow
+   ///
+   /// Hook for printables that rasterize themselves straight into a window's frame buffer instead of going
+   /// through the window's per-animation sprite path (instanced printables for example)
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   /// @param deltaTime - Time since the last refresh
+   /// @return True if the printable drew itself, false to let the window draw the current animation
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   virtual bool drawToWindow(NcursesWindow& window, const float deltaTime);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn eraseBatched
+   ///
+   /// Hook for batched printables to erase what they drew last refresh. Called before the window's draw
+   /// phase, so printables underneath are drawn back over the erased cells.
+   ///
+   /// @param window - Window whose frame buffer is being drawn
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   virtual void eraseBatched(NcursesWindow& window);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isBatched
+   ///
+   /// @return True if the printable advances its own animation state inside drawToWindow, so the window's
+   /// animation clock should leave it alone
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   virtual bool isBatched() const;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn isVisable
    ///
@@ -192,6 +226,45 @@ public:
    /// @param window - The ncurses window to associate with this printable
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void setNcurseWindow(WINDOW* window);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setBackgroundOverride
+   ///
+   /// Draws the printable with one background color behind every pixel. Applied when the sprite is copied
+   /// into the frame buffer, the sprite's pixels are never changed.
+   ///
+   /// @param color - Background color to draw with
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setBackgroundOverride(const RGB& color);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn clearBackgroundOverride
+   ///
+   /// Draws the printable with the pixels' own background colors again
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void clearBackgroundOverride();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hasBackgroundOverride
+   ///
+   /// @return True if the printable is drawn with an override background color
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool hasBackgroundOverride() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getBackgroundOverride
+   ///
+   /// @return The override background color, only drawn while hasBackgroundOverride is true
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const RGB& getBackgroundOverride() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn keepsOwnBackground
+   ///
+   /// @param pixelIndex - Index of a pixel in the current sprite
+   /// @return True if the pixel is drawn with its own background despite the override
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   virtual bool keepsOwnBackground(const size_t pixelIndex) const;
 };
 
 #endif
\ No newline at end of file
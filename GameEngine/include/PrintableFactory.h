@@ -12,13 +12,19 @@
 #ifndef PRINTABLEFACTORY_H
 #define PRINTABLEFACTORY_H
 
+#include "AnimationArchive.h"
+#include "AnimationFile.h"
+#include "AnimationManifest.h"
+#include "AsyncLoad.h"
 #include "Button.h"
 #include "Entity.h"
 #include "InputHandler.h"
 #include "Parameters.h"
 #include "Printable.h"
+#include "ThreadPool.h"
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -30,6 +36,201 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class PrintableFactory
 {
+private:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getTextFrameFiles
+   ///
+   /// @param folderPath - Animation directory
+   /// @param manifest - If not null, receives the directory's AnimationManifest when it is current
+   /// @return Text frame files in play order: the manifest's order when it is current, otherwise by filename
+   /// with numbers compared by value (frame2 before frame10). The compiled file and manifest are left out.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static std::vector<std::filesystem::directory_entry>
+   getTextFrameFiles(const std::string folderPath, AnimationManifest* manifest = nullptr);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadManifest
+   ///
+   /// Only the manifest is read, the frame files are just listed
+   ///
+   /// @param folderPath - Animation directory
+   /// @param textFrameFiles - Text frames in the directory
+   /// @param manifest - Receives the manifest
+   /// @return True if the manifest lists exactly these files and is at least as new as every one of them
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool loadManifest(const std::string                                   folderPath,
+                            const std::vector<std::filesystem::directory_entry>& textFrameFiles,
+                            AnimationManifest&                                   manifest);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn buildManifest
+   ///
+   /// Parses and hashes every text frame, concurrently on the loader ThreadPool
+   ///
+   /// @param textFrameFiles - Text frames in play order
+   /// @param manifest - Receives one entry per frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void buildManifest(const std::vector<std::filesystem::directory_entry>& textFrameFiles,
+                             AnimationManifest&                                   manifest);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isArchiveCurrent
+   ///
+   /// Only walks the entity's directory tree when it exists and trustAnimationArchives is not set, every
+   /// file and directory in it is then one stat
+   ///
+   /// @param entityFolderPath - Entity directory, for example src/Animations/player
+   /// @return True if the entity has an AnimationArchive and no file or directory in its tree is newer,
+   /// there is no directory at all or archives are trusted
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isArchiveCurrent(const std::string entityFolderPath);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadArchiveFrames
+   ///
+   /// Reads and parses an archived animation's frames concurrently on the loader ThreadPool
+   ///
+   /// @param archive - Open archive
+   /// @param archived - Animation's index entry in the archive
+   /// @param frames - Receives the frames in play order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void loadArchiveFrames(const AnimationArchive&                 archive,
+                                 const AnimationArchive::AnimationEntry& archived,
+                                 std::vector<Frame>&                     frames);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readFrameTexts
+   ///
+   /// @param folderPath - Animation directory
+   /// @param frameTexts - Receives the text of every frame in play order, from the AnimationSheet, the text
+   /// frame files or, when there are neither, the compiled AnimationFile
+   /// @return True if the frames could be read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool readFrameTexts(const std::string folderPath, std::vector<std::string>& frameTexts);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadSheetFrames
+   ///
+   /// Reads the animation's AnimationSheet in one pass and parses its frames on the loader ThreadPool
+   ///
+   /// @param folderPath - Animation directory
+   /// @param frames - Receives the frames in play order
+   /// @return False if the directory has no readable AnimationSheet
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool loadSheetFrames(const std::string folderPath, std::vector<Frame>& frames);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isCompiledCurrent
+   ///
+   /// @param folderPath - Animation directory
+   /// @param textFrameFiles - Text frames in the directory
+   /// @param compiledFrameCount - Frame count of the opened AnimationFile
+   /// @return True if the directory has a compiled AnimationFile at least as new as every text frame, the
+   /// AnimationSheet and the AnimationManifest, holding one frame per text frame
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool isCompiledCurrent(const std::string                                   folderPath,
+                                 const std::vector<std::filesystem::directory_entry>& textFrameFiles,
+                                 const size_t                                         compiledFrameCount);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn readFrameHeader
+   ///
+   /// @param fileLocation - Path to a text frame file
+   /// @return Frame with the file's duration and layer and no pixels, only the first line is read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static Frame readFrameHeader(const std::string fileLocation);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadCompiledFrames
+   ///
+   /// @param folderPath - Animation directory
+   /// @param textFrameFiles - Text frames in the directory, the compiled file is skipped if any is newer
+   /// @param frames - Filled with the compiled frames
+   /// @return True if frames were loaded from a current compiled AnimationFile
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool loadCompiledFrames(const std::string                                   folderPath,
+                                  const std::vector<std::filesystem::directory_entry>& textFrameFiles,
+                                  std::vector<Frame>&                                  frames);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn buildAnimation
+   ///
+   /// @param animationName - Name of the animation
+   /// @param frames - Loaded frames in order
+   /// @param repeats - Stops animation at the end of cycle or not
+   /// @param keyframeInterval - If not 0, the frames are delta encoded
+   /// @return Animation ready to play, single frame animations are paused
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static Animation buildAnimation(const std::string animationName, std::vector<Frame> frames,
+                                   const bool repeats, const size_t keyframeInterval);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadAnimations
+   ///
+   /// Loads every animation directory of an entity. The text frames of all animations are parsed
+   /// concurrently on the loader ThreadPool; animations come back sorted by directory name and frames by
+   /// filename, whatever order the workers finish in.
+   ///
+   /// @param directoryName - Directory under src/Animations holding one directory per animation
+   /// @param repeats - Stops animations at the end of cycle or not
+   /// @param keyframeInterval - If not 0, animations are delta encoded with this keyframe interval
+   /// @return Loaded animations
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static std::vector<Animation> loadAnimations(const std::string directoryName, const bool repeats,
+                                                const size_t keyframeInterval);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn addToWindow
+   ///
+   /// Adds a loaded printable to its window, the first window if none is given
+   ///
+   /// @param printable - Printable to add
+   /// @param ncursesWindow - Window to add the printable to, may be null
+   /// @param description - Kind and name of the printable used in the warning when there is no window
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void addToWindow(const std::shared_ptr<Printable>& printable,
+                           std::shared_ptr<NcursesWindow> ncursesWindow, const std::string description);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn startLoad
+   ///
+   /// Parses a directory's animations on the loader ThreadPool and registers the load so the game loop
+   /// completes it on the main thread
+   ///
+   /// @param directoryName - Directory under src/Animations holding one directory per animation
+   /// @param keyframeInterval - If not 0, animations are delta encoded with this keyframe interval
+   /// @param attach - Builds the printable from the animations and adds it to its window, main thread only
+   /// @param onLoaded - Called on the main thread with the printable once it is attached, may be empty
+   /// @return Handle to the load
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   template <typename T>
+   static std::shared_ptr<AsyncLoad<T>> startLoad(const std::string               directoryName,
+                                                  const size_t                    keyframeInterval,
+                                                  typename AsyncLoad<T>::Attach   attach,
+                                                  typename AsyncLoad<T>::OnLoaded onLoaded)
+   {
+      std::future<std::vector<Animation>> animations = ThreadPool::getLoaderPool().submit(
+          [directoryName, keyframeInterval]()
+          { return loadAnimations(directoryName, true, keyframeInterval); });
+
+      auto load = std::make_shared<AsyncLoad<T>>(directoryName, std::move(animations), std::move(attach),
+                                                 std::move(onLoaded));
+      addPendingLoad(
+          [load]()
+          {
+             load->poll();
+             return load->isDone();
+          });
+      return load;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn addPendingLoad
+   ///
+   /// @param poll - Completes the load if it is ready, returns true once the load is done
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void addPendingLoad(std::function<bool()> poll);
+
 public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn getFrameFromTextFile
@@ -37,9 +238,14 @@ public:
    /// Loads a Frame from a text file. The file format is:
    /// First line: duration,layer
    /// Next N lines: ASCII art
+   /// Then either the dense style sections after a --- line:
    /// Next N lines: text RGB values (r,g,b per pixel, comma-separated, space between pixels)
    /// Next N lines: background RGB values (r,g,b per pixel, comma-separated, space between pixels)
    /// Next N lines: attribute values (integer per pixel, space between pixels)
+   /// Or the sparse style sections after a ---sparse line:
+   /// default text r,g,b background r,g,b attribute - style of every cell not covered by a run
+   /// t|b|a y x count value - run of count cells on row y from column x with that text color, background
+   /// color or attribute
    ///
    /// @param fileLocation - Path to the text file to load
    /// @return Frame loaded from the text file
@@ -49,13 +255,116 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn loadAnimation
    ///
+   /// Reads the animation from the entity's AnimationArchive when it is current. Otherwise loads the compiled
+   /// AnimationFile in the animation directory when it is at least as new as every text frame, otherwise
+   /// reads the AnimationSheet if there is one, otherwise parses the text frame files. Text frames are parsed
+   /// concurrently on the loader ThreadPool.
+   ///
    /// @param entityName - Name of directory where all animations associated with this entity is stored
    /// @param animationName - Name of animation directory within entity directory
    /// @param repeats - Stops animation at the end of cycle or not
+   /// @param keyframeInterval - If not 0, frames are stored as keyframes every keyframeInterval frames and
+   /// cell deltas in between (see Animation::encodeDeltas)
    /// @return Loaded Animation from inputed entityName/animationName
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    static Animation loadAnimation(const std::string entityName, const std::string animationName,
-                                  const bool repeats);
+                                  const bool repeats, const size_t keyframeInterval = 0);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn streamAnimation
+   ///
+   /// Opens an animation for streaming playback instead of loading every frame (see FrameStream). Only
+   /// frame durations and layers are read up front, from the AnimationArchive's index, the compiled
+   /// AnimationFile's frame table or the AnimationManifest when one of them is current, the record index
+   /// of an AnimationSheet, or the first line of each text frame otherwise. Meant for long clips, memory
+   /// stays bounded by memoryCap plus the two frames the Animation holds.
+   ///
+   /// @param entityName - Name of directory where all animations associated with this entity is stored
+   /// @param animationName - Name of animation directory within entity directory
+   /// @param repeats - Stops animation at the end of cycle or not
+   /// @param memoryCap - Bytes of decoded frames the stream buffers ahead of the playhead
+   /// @return Streamed Animation from inputed entityName/animationName
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static Animation streamAnimation(const std::string entityName, const std::string animationName,
+                                    const bool repeats, const size_t memoryCap = maxStreamBufferBytes);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn reloadTextFrames
+   ///
+   /// Re-parses only the named text frame files of an animation, concurrently on the loader ThreadPool. Used
+   /// for hot reload (see AnimationWatcher), names that are not text frames of the directory are skipped.
+   ///
+   /// @param folderPath - Animation directory
+   /// @param fileNames - Names of the changed text frame files
+   /// @param frameIndices - Receives the play order index of each parsed frame
+   /// @param frames - Receives the parsed frames
+   /// @return Number of text frames in the directory
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static size_t reloadTextFrames(const std::string folderPath, const std::vector<std::string>& fileNames,
+                                  std::vector<size_t>& frameIndices, std::vector<Frame>& frames);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn describeAnimation
+   ///
+   /// Frame order, durations, layers, bounding boxes and hashes of an animation, for asset browsers and
+   /// startup checks. Read from the AnimationManifest when it is current, no frame file is opened. Otherwise
+   /// every frame is parsed and hashed, nothing is written. Frames of an AnimationSheet are named
+   /// sheet.txt:index.
+   ///
+   /// @param entityName - Name of directory where all animations associated with this entity is stored
+   /// @param animationName - Name of animation directory within entity directory
+   /// @param manifest - Receives the description
+   /// @return True if the animation directory could be read
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool describeAnimation(const std::string entityName, const std::string animationName,
+                                 AnimationManifest& manifest);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn writeManifest
+   ///
+   /// Builds the AnimationManifest of an animation directory from its text frames and writes it. A directory
+   /// holding an AnimationSheet needs no manifest and is left alone.
+   ///
+   /// @param folderPath - Animation directory, for example src/Animations/player/idle
+   /// @return True if the manifest was written or is not needed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool writeManifest(const std::string folderPath);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn validateAnimation
+   ///
+   /// Checks the frame files of an animation directory against its AnimationManifest. A directory holding an
+   /// AnimationSheet is checked for a readable sheet and no stray frame files instead.
+   ///
+   /// @param folderPath - Animation directory, for example src/Animations/player/idle
+   /// @param checkContents - Also rehash every frame file, otherwise only the file list is compared
+   /// @param problems - Receives one message per missing, unlisted or changed frame file
+   /// @return True if the manifest exists and matches the frame files
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool validateAnimation(const std::string folderPath, const bool checkContents,
+                                 std::vector<std::string>& problems);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn writeArchive
+   ///
+   /// Packs every animation directory of an entity into its AnimationArchive, which is written next to the
+   /// directory and read in its place while nothing in the directory is newer
+   ///
+   /// @param entityFolderPath - Entity directory, for example src/Animations/player
+   /// @param compress - Compress the frames
+   /// @return True if the archive was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool writeArchive(const std::string entityFolderPath, const bool compress = true);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn compileAnimation
+   ///
+   /// Compiles the text frames of an animation directory into its AnimationFile
+   ///
+   /// @param folderPath - Animation directory, for example src/Animations/player/idle
+   /// @return True if the compiled file was written
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool compileAnimation(const std::string folderPath);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn loadEntity
@@ -65,11 +374,14 @@ public:
    /// @param directoryLocation - Name of directory where all animations associated with this entity is stored
    /// @param visable - Visibility flag
    /// @param moveableByCamera - Whether the entity moves with camera
+   /// @param ncursesWindow - Window to add the entity to, the first window if null
+   /// @param keyframeInterval - If not 0, animations are delta encoded with this keyframe interval
    /// @return Loaded Entity from inputed entityName
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    static std::shared_ptr<Entity> loadEntity(const std::string directoryLocation, const bool visable,
                                              const bool                     moveableByCamera,
-                                             std::shared_ptr<NcursesWindow> ncursesWindow = nullptr);
+                                             std::shared_ptr<NcursesWindow> ncursesWindow    = nullptr,
+                                             const size_t                   keyframeInterval = 0);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn loadUIElement
@@ -100,24 +412,101 @@ public:
                                              const bool moveableByCamera, std::function<void()> function,
                                              std::shared_ptr<NcursesWindow> ncursesWindow = nullptr);
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadEntityAsync
+   ///
+   /// Same as loadEntity, but returns at once. The animations are parsed in the background and the entity is
+   /// added to its window on the main thread by completePendingLoads.
+   ///
+   /// @param directoryLocation - Name of directory where all animations associated with this entity is stored
+   /// @param visable - Visibility flag
+   /// @param moveableByCamera - Whether the entity moves with camera
+   /// @param ncursesWindow - Window to add the entity to, the first window if null
+   /// @param keyframeInterval - If not 0, animations are delta encoded with this keyframe interval
+   /// @param onLoaded - Called on the main thread with the entity once it is added to its window
+   /// @return Handle to the load
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static std::shared_ptr<AsyncLoad<Entity>>
+   loadEntityAsync(const std::string directoryLocation, const bool visable, const bool moveableByCamera,
+                   std::shared_ptr<NcursesWindow> ncursesWindow = nullptr, const size_t keyframeInterval = 0,
+                   AsyncLoad<Entity>::OnLoaded onLoaded = nullptr);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadUIElementAsync
+   ///
+   /// Same as loadUIElement, but returns at once. The animations are parsed in the background and the UI
+   /// element is added to its window on the main thread by completePendingLoads.
+   ///
+   /// @param directoryName - Directory name to load from
+   /// @param visable - Visibility flag
+   /// @param moveableByCamera - Whether the UI element moves with camera
+   /// @param ncursesWindow - Window to add the UI element to, the first window if null
+   /// @param onLoaded - Called on the main thread with the UI element once it is added to its window
+   /// @return Handle to the load
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static std::shared_ptr<AsyncLoad<UIElement>>
+   loadUIElementAsync(const std::string directoryName, const bool visable, const bool moveableByCamera,
+                      std::shared_ptr<NcursesWindow> ncursesWindow = nullptr,
+                      AsyncLoad<UIElement>::OnLoaded onLoaded      = nullptr);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn loadButtonAsync
+   ///
+   /// Same as loadButton, but returns at once. The animations are parsed in the background and the button is
+   /// added to its window and the global InputHandler on the main thread by completePendingLoads.
+   ///
+   /// @param directoryName - Directory name to load from
+   /// @param visable - Visibility flag
+   /// @param moveableByCamera - Whether the button moves with camera
+   /// @param function - The function that'll be assigned to the button when thisButton.executeFunction()
+   /// @param ncursesWindow - Window to add the button to, the first window if null
+   /// @param onLoaded - Called on the main thread with the button once it is registered
+   /// @return Handle to the load
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static std::shared_ptr<AsyncLoad<Button>>
+   loadButtonAsync(const std::string directoryName, const bool visable, const bool moveableByCamera,
+                   std::function<void()> function, std::shared_ptr<NcursesWindow> ncursesWindow = nullptr,
+                   AsyncLoad<Button>::OnLoaded onLoaded = nullptr);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn completePendingLoads
+   ///
+   /// Completes every asynchronous load whose animations are parsed. Called once per frame by the game
+   /// loop, must only run on the main thread.
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static void completePendingLoads();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hasPendingLoads
+   ///
+   /// @return True while an asynchronous load has not completed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static bool hasPendingLoads();
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn writePrintableToTextFiles
    ///
    /// Writes the given Printable object to .txt files in the format:
    /// src/Animations/m_printableName/m_animationName/frameN.txt
-   /// Each animation is a folder, each frame is a .txt file.
-   /// Overwrites existing files.
+   /// Each animation is a folder, each frame is a .txt file, and each folder gets an AnimationManifest.
+   /// Overwrites existing files and removes frameN.txt files left over from a longer animation. As a sheet
+   /// every frame goes into the folder's AnimationSheet instead and its frame files and manifest are removed.
    ///
-   /// File format:
+   /// Saves are incremental: frames are serialized and hashed concurrently on the loader ThreadPool and only
+   /// files whose hash differs from the current manifest or sheet are written. Every file is written to a
+   /// temporary file and renamed over the old one, so an interrupted save never leaves a partial frame.
+   ///
+   /// File format (see getFrameFromTextFile):
    /// First line: duration,layer
    /// Next N lines: ASCII art
-   /// Next N lines: text RGB values (r,g,b per pixel, comma-separated, space between pixels)
-   /// Next N lines: background RGB values (r,g,b per pixel, comma-separated, space between pixels)
-   /// Next N lines: attribute values (integer per pixel, space between pixels)
+   /// Styles in the sparse sections, the most common style of each section as its default plus runs of the
+   /// cells that differ. Frames needing more runs than half their cells fall back to the dense sections.
    ///
    /// @param printable - The Printable object to write
+   /// @param asSheet - Write each animation as one AnimationSheet instead of one file per frame
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   static void writePrintableToTextFiles(const std::shared_ptr<Printable>& printable);
+   static void writePrintableToTextFiles(const std::shared_ptr<Printable>& printable,
+                                         const bool                        asSheet = false);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn newButton
@@ -24,20 +24,23 @@
 /// The slider is printable and can be displayed on the screen.
 /// By default, uses a horizontal slider with a bar and a handle.
 /// If the user sets their own animation, they are responsible for updating the visual state.
+/// The default sprite keeps one cell per step, moving the handle only rewrites the two cells whose glyph
+/// changes.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class Slider : public UIElement
 {
 private:
-   int  m_length;     // Number of steps/positions (minimum 2)
-   int  m_position;   // Current handle position (0 ... m_length-1)
-   bool m_horizontal; // True for horizontal, false for vertical
+   int  m_length;          // Number of steps/positions (minimum 2)
+   int  m_position;        // Current handle position (0 ... m_length-1)
+   bool m_horizontal;      // True for horizontal, false for vertical
+   bool m_customAnimation; // Set by setAnimation, the slider no longer draws its cells
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   /// @fn updateSprite
+   /// @fn layoutCells
    ///
-   /// Updates the default sprite/animation to reflect the current slider position.
+   /// Lays out one cell per step in the default sprite, reusing its pixels and keeping its anchor.
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   void updateSprite();
+   void layoutCells();
 
 public:
    Slider(int length = 10, bool horizontal = true);
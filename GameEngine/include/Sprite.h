@@ -30,7 +30,7 @@ private:
 public:
    Sprite();
    Sprite(const std::vector<Pixel> pixels);
-   Sprite(const std::vector<Pixel> pixels, const int layer);
+   Sprite(std::vector<Pixel> pixels, const int layer);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setAnchor
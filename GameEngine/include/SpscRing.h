@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file SpscRing.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Lock-free ring buffer for one producer thread and one consumer thread
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class SpscRing
+///
+/// Fixed capacity FIFO shared by exactly one producer and one consumer thread, neither side ever blocks or
+/// takes a lock. The producer only writes the tail and the consumer only writes the head, each on its own
+/// cache line, and a slot is published by the release store of the index that hands it over.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T> class SpscRing
+{
+private:
+   std::vector<T>                  m_slots;
+   size_t                          m_mask;
+   alignas(64) std::atomic<size_t> m_head; // Next slot to pop, written by the consumer
+   alignas(64) std::atomic<size_t> m_tail; // Next slot to push, written by the producer
+
+public:
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn SpscRing
+   ///
+   /// @param capacity - Minimum number of queued values, rounded up to a power of two
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   explicit SpscRing(const size_t capacity)
+   {
+      size_t size = 2;
+      while (size < capacity)
+         size <<= 1;
+
+      m_slots.resize(size);
+      m_mask = size - 1;
+      m_head.store(0, std::memory_order_relaxed);
+      m_tail.store(0, std::memory_order_relaxed);
+   }
+
+   SpscRing(const SpscRing&)            = delete;
+   SpscRing& operator=(const SpscRing&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn push
+   ///
+   /// Producer thread only
+   ///
+   /// @param value - Value to queue
+   /// @return False if the ring is full, the value is not queued
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool push(const T& value)
+   {
+      size_t tail = m_tail.load(std::memory_order_relaxed);
+      if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+         return false;
+
+      m_slots[tail & m_mask] = value;
+      m_tail.store(tail + 1, std::memory_order_release);
+      return true;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn pop
+   ///
+   /// Consumer thread only
+   ///
+   /// @param value - Receives the oldest queued value
+   /// @return False if the ring is empty
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool pop(T& value)
+   {
+      size_t head = m_head.load(std::memory_order_relaxed);
+      if (head == m_tail.load(std::memory_order_acquire))
+         return false;
+
+      value = m_slots[head & m_mask];
+      m_head.store(head + 1, std::memory_order_release);
+      return true;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn capacity
+   ///
+   /// @return Number of values the ring holds when full
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t capacity() const { return m_slots.size(); }
+};
+
+#endif
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TerminalDecoder.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Turns raw terminal input bytes into key and mouse events
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TERMINALDECODER_H
+#define TERMINALDECODER_H
+
+#include "InputQueue.h"
+#include <ncurses.h>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class TerminalDecoder
+///
+/// Decodes what an xterm compatible terminal sends into the same codes getch and getmouse report: plain
+/// bytes are keys, cursor and function key escape sequences become KEY_* codes (with Shift, Alt or Ctrl the
+/// codes ncurses gives the terminfo keys such as kri or kUP5) and xterm mouse reports become KEY_MOUSE
+/// events. Both SGR (?1006) reports, which have no column limit and name the released button, and the older
+/// x10 reports, limited to 223 columns, are understood. A whole read is decoded in one pass instead of one
+/// getch and getmouse round trip per event.
+///
+/// Input can split an escape sequence between two reads, the unfinished tail is kept and completed by the
+/// next decode call. If nothing follows, flush hands the kept bytes out as plain keys, which is how a lone
+/// Escape key press is told apart from the start of a sequence.
+///
+/// The modified key codes are looked up in ncurses once, by the constructor, decoding only reads the table.
+/// Construct the decoder on the thread that owns ncurses, after Display::initCurse, it can then be handed
+/// to another thread.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TerminalDecoder
+{
+private:
+   std::string                           m_pending;        // Unfinished escape sequence from the last read
+   std::chrono::steady_clock::time_point m_pendingSince;   // When the unfinished sequence started
+   mmask_t                               m_pressedButtons; // BUTTONn_PRESSED bits, x10 releases are unnamed
+   std::map<std::pair<int, int>, int>    m_modifiedKeys;   // (key, xterm modifier) to the terminfo key code
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn modifiedKey
+   ///
+   /// @param key - Unmodified key code
+   /// @param modifier - xterm modifier parameter, 2 for Shift up to 8 for Shift+Alt+Ctrl
+   /// @return Code ncurses gives the terminal's modified key (kri, kUP5, kf25...), key if terminfo has none
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   int modifiedKey(const int key, const int modifier) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn addMouseEvent
+   ///
+   /// @param code - xterm button code, the button in the low two bits plus modifier, motion and wheel bits
+   /// @param released - True for a release report
+   /// @param x - Screen column, 0 based
+   /// @param y - Screen row, 0 based
+   /// @param timestamp - When the bytes were read
+   /// @param events - Receives the event
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void addMouseEvent(const int code, const bool released, const int x, const int y,
+                      const std::chrono::steady_clock::time_point timestamp, std::vector<InputEvent>& events);
+
+public:
+   // Longest a lone Escape waits for the rest of a sequence, ncurses waits a whole second by default
+   static constexpr int ESCAPE_TIMEOUT_MILLISECONDS = 25;
+
+   TerminalDecoder();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn decode
+   ///
+   /// Decodes bytes in one pass. An escape sequence cut off at the end is kept for the next call.
+   ///
+   /// @param bytes - Bytes read from the terminal
+   /// @param length - Number of bytes
+   /// @param timestamp - When the bytes were read
+   /// @param events - Receives the decoded events in order
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void decode(const char* bytes, const size_t length, const std::chrono::steady_clock::time_point timestamp,
+               std::vector<InputEvent>& events);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn hasPartialSequence
+   ///
+   /// @return True if the last decode ended inside an escape sequence
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool hasPartialSequence() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn flush
+   ///
+   /// Gives up on the kept escape sequence and hands its bytes out as plain keys
+   ///
+   /// @param timestamp - Timestamp of the events
+   /// @param events - Receives the events
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void flush(const std::chrono::steady_clock::time_point timestamp, std::vector<InputEvent>& events);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn flushExpired
+   ///
+   /// Flushes the kept escape sequence once it waited ESCAPE_TIMEOUT_MILLISECONDS for the rest
+   ///
+   /// @param now - Current time, also the timestamp of the events
+   /// @param events - Receives the events
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void flushExpired(const std::chrono::steady_clock::time_point now, std::vector<InputEvent>& events);
+};
+
+#endif
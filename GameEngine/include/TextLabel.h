@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TextLabel.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Text laid out into a sprite's cells, rewritten in place when the text changes
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXTLABEL_H
+#define TEXTLABEL_H
+
+#include "Pixel.h"
+#include "Sprite.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class LabelChange
+///
+/// What a new text does to a label's cells, from cheapest to most expensive
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+enum class LabelChange
+{
+   NONE,   // Same text
+   GLYPHS, // Same cells, only characters are rewritten
+   CELLS,  // Cells are laid out again within the same width and height
+   SIZE    // Width or height changed, the label's group has to be laid out again
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class TextLabel
+///
+/// Lays text out into the pixels of a sprite, one line per row, optionally inside a border drawn from eight
+/// corner and edge glyphs. A bordered label is a box at least two columns wider than its longest line, so
+/// text of the same line count and a similar length fits the same cells and only the characters that
+/// differ are rewritten, keeping the pixels' position, colors and attributes. Only a text that changes
+/// the cells rebuilds the pixels, in the vector they already use, around the sprite's current anchor.
+///
+/// A change is measured first and applied second, so the owner can save the old sprite for erasing or
+/// skip the relayout when the size stays the same.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TextLabel
+{
+private:
+   std::string         m_text;
+   std::vector<size_t> m_lineLengths;
+   int                 m_width;
+   int                 m_height;
+   bool                m_bordered;
+   bool                m_drawn; // False until the first apply, the sprite holds other art
+
+   // Measured by measure, taken over by apply
+   std::string         m_pendingText;
+   std::vector<size_t> m_pendingLineLengths;
+   int                 m_pendingWidth;
+   int                 m_pendingHeight;
+   LabelChange         m_pendingChange;
+
+   // Border glyphs
+   wchar_t m_topLeft;
+   wchar_t m_topRight;
+   wchar_t m_bottomLeft;
+   wchar_t m_bottomRight;
+   wchar_t m_topEdge;
+   wchar_t m_bottomEdge;
+   wchar_t m_leftEdge;
+   wchar_t m_rightEdge;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn measurePending
+   ///
+   /// Measures m_pendingText against the current layout
+   ///
+   /// @return What applying it will change
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   LabelChange measurePending();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getGlyph
+   ///
+   /// @param column - Column in the label, border included
+   /// @param row - Row in the label, border included
+   /// @param lineStart - Offset of the row's line in m_text
+   /// @param lineLength - Length of the row's line
+   /// @return Character of the cell
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   wchar_t getGlyph(const int column, const int row, const size_t lineStart, const size_t lineLength) const;
+
+public:
+   TextLabel();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn setBorderGlyphs
+   ///
+   /// Takes the corner and edge glyphs of bordered art, like a button's default sprite. Glyphs the pixels
+   /// do not cover stay '+', '-' and '|'.
+   ///
+   /// @param pixels - Pixels of the bordered art
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void setBorderGlyphs(const std::vector<Pixel>& pixels);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn measure
+   ///
+   /// Measures a new text without touching the sprite, apply lays it out
+   ///
+   /// @param text - New text, lines separated by '\n'
+   /// @return What applying the text will change
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   LabelChange measure(const std::string& text);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn measureBordered
+   ///
+   /// Measures the current text with or without the border, apply lays it out
+   ///
+   /// @param bordered - Whether the text is drawn inside a border
+   /// @return What applying will change
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   LabelChange measureBordered(const bool bordered);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn apply
+   ///
+   /// Writes the last measured text into the sprite
+   ///
+   /// @param sprite - Sprite holding the label's cells
+   /// @return What changed, CELLS instead of GLYPHS if the sprite no longer held the label's cells
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   LabelChange apply(Sprite& sprite);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getCellIndex
+   ///
+   /// @param column - Column of a character in its line
+   /// @param row - Line of the character
+   /// @param index - Receives the index of the character's pixel in the sprite
+   /// @return False if the text has no such character
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool getCellIndex(const size_t column, const size_t row, size_t& index) const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getText
+   ///
+   /// @return Text the label shows
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   const std::string& getText() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isBordered
+   ///
+   /// @return Whether the text is drawn inside a border
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isBordered() const;
+};
+
+#endif
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ThreadPool.h
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Fixed size pool of worker threads for background and parallel work
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class ThreadPool
+///
+/// Workers pull tasks from one shared queue. submit queues a single task and hands back its future,
+/// parallelFor splits an index range over the workers and the calling thread. parallelFor never waits on a
+/// task that has not started, so it is safe to call from inside a pool task.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThreadPool
+{
+private:
+   std::vector<std::thread>          m_workers;
+   std::deque<std::function<void()>> m_tasks;
+   std::mutex                        m_mutex;
+   std::condition_variable           m_taskAvailable;
+   bool                              m_stopping;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn workerLoop
+   ///
+   /// Runs queued tasks until the pool is destroyed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void workerLoop();
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn enqueue
+   ///
+   /// @param task - Task to append to the queue
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void enqueue(std::function<void()> task);
+
+public:
+   ThreadPool(const size_t threadCount);
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&)            = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn submit
+   ///
+   /// @param task - Callable run on a worker thread
+   /// @return Future holding the task's result, or the exception it threw
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   template <typename Task> auto submit(Task task) -> std::future<decltype(task())>
+   {
+      using Result = decltype(task());
+
+      auto                packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+      std::future<Result> future   = packaged->get_future();
+      enqueue([packaged]() { (*packaged)(); });
+      return future;
+   }
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn parallelFor
+   ///
+   /// Calls body once for every index in [0, count) and returns when all calls are done. Indexes are
+   /// handed out one at a time to the workers and the calling thread.
+   ///
+   /// @param count - Number of indexes
+   /// @param body - Called with each index, must be safe to run concurrently
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void parallelFor(const size_t count, const std::function<void(size_t)>& body);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getThreadCount
+   ///
+   /// @return Number of worker threads
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   size_t getThreadCount() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn getLoaderPool
+   ///
+   /// Shared pool used for asset loading. Created on first use with maxLoaderThreads workers, or fewer if
+   /// the machine has fewer cores.
+   ///
+   /// @return Asset loading pool
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   static ThreadPool& getLoaderPool();
+};
+
+#endif
@@ -68,6 +68,21 @@ protected:
    bool               m_borderAutoSize;
    std::vector<Pixel> m_originalPixels; // Store original sprite without borders
 
+   // Layout cache, the element's group is only laid out again once one of these no longer matches
+   Position      m_layoutSize;         // Measured width and height, kept by setPositions
+   bool          m_layoutDirty;        // Size changed since the element was last placed
+   WINDOW*       m_layoutWindow;       // Window the element was last placed in
+   Position      m_layoutArea;         // Usable size of that window at the time
+   Position      m_layoutPosition;     // Where it was placed
+   unsigned long m_layoutGroupVersion; // Anchor group membership it was placed with
+
+   // Sprite setPositions last measured, one reshaped without it (hot reload, animation switch) is measured
+   // again before the next layout pass
+   const Animation* m_measuredAnimation;
+   uint64_t         m_measuredVersion;
+   size_t           m_measuredFrameIndex;
+   size_t           m_measuredPixelCount;
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setPositions
    ///
@@ -75,6 +90,34 @@ protected:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    void setPositions();
 
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn isMeasurementStale
+   ///
+   /// @return True if the sprite may have changed shape since setPositions measured it: another animation or
+   /// frame is current, its frames were replaced or it holds a different number of pixels
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool isMeasurementStale() const;
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn needsLayout
+   ///
+   /// @param window - Window the element is laid out in
+   /// @param area - Usable size of the window
+   /// @return True if the element changed size or moved since it was placed, or its window or group changed
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   bool needsLayout(WINDOW* window, Position area);
+
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   /// @fn place
+   ///
+   /// Moves the element by the offset to position, if any, and records the layout it was placed with
+   ///
+   /// @param position - Top left cell of the element
+   /// @param window - Window the element is laid out in
+   /// @param area - Usable size of the window
+   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+   void place(Position position, WINDOW* window, Position area);
+
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn applyBorder
    ///
@@ -129,7 +172,9 @@ public:
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn updateAllLockedPositions
    ///
-   /// Updates all elements. Gets called every time the terminal gets resized
+   /// Updates all elements. Gets called every time the terminal gets resized and after UI content changes.
+   /// Only anchor groups with an element that changed size or moved, a window that was resized or a change
+   /// in membership are laid out again, the others are left where they are.
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    static void updateAllLockedPositions();
 
@@ -172,7 +217,7 @@ public:
    ///
    /// @param enabled - Whether to enable or disable the border
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-   void setBorder(bool enabled);
+   virtual void setBorder(bool enabled);
 
    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
    /// @fn setBorder
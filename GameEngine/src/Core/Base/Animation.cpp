@@ -10,6 +10,13 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../../../include/Animation.h"
+#include "../../../include/FrameStream.h"
+#include "../../../include/Parameters.h"
+#include <atomic>
+#include <utility>
+
+// Shared by every animation so versions never repeat, even in copies. Animations are built on loader threads.
+static std::atomic<uint64_t> nextTimingVersion{0};
 
 // public ----------------------------------------------------------------------------------------------------
 Animation::Animation()
@@ -21,14 +28,44 @@ Animation::Animation()
 };
 
 // public ----------------------------------------------------------------------------------------------------
-Animation::Animation(const std::string animationName, const std::vector<Frame> frames, const bool repeats)
+Animation::Animation(const std::string animationName, std::vector<Frame> frames, const bool repeats)
 {
    m_animationName = animationName;
-   m_frames        = frames;
+   m_frames        = std::move(frames);
    m_repeats       = repeats;
    m_playing       = true;
 };
 
+// public ----------------------------------------------------------------------------------------------------
+Animation::Animation(const Animation& other)
+   : m_animationName(other.m_animationName), m_frames(other.m_frames), m_repeats(other.m_repeats),
+     m_playing(other.m_playing), currentFrameIndex(other.currentFrameIndex),
+     previousFrameIndex(other.previousFrameIndex), frameTimer(other.frameTimer), m_offsetX(other.m_offsetX),
+     m_offsetY(other.m_offsetY),
+     m_deltaEncoded(other.m_deltaEncoded), m_keyframeInterval(other.m_keyframeInterval),
+     m_decodedSprite(other.m_decodedSprite), m_decodedFrameIndex(other.m_decodedFrameIndex),
+     m_decodedCells(other.m_decodedCells), m_vacatedPositions(other.m_vacatedPositions),
+     m_streamedFrame(other.m_streamedFrame), m_previousStreamedFrame(other.m_previousStreamedFrame),
+     m_streamedFrameIndex(other.m_streamedFrameIndex), m_timingVersion(other.m_timingVersion)
+{
+   // Sharing the stream would have both copies take each other's frames. The clone starts reading once the
+   // copy moves off the frame it was copied on.
+   if (other.m_stream != nullptr)
+   {
+      m_stream = other.m_stream->clone();
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+Animation& Animation::operator=(const Animation& other)
+{
+   if (this != &other)
+   {
+      *this = Animation(other);
+   }
+   return *this;
+};
+
 // public ----------------------------------------------------------------------------------------------------
 const std::vector<Frame>& Animation::getFrames() const
 {
@@ -41,10 +78,19 @@ void Animation::update(const float deltaTime)
    if (m_frames.empty() || !m_playing)
       return;
 
-   frameTimer += deltaTime;
+   applyFrameTimer(frameTimer + deltaTime);
+   touchTiming();
+};
 
+// public ----------------------------------------------------------------------------------------------------
+bool Animation::applyFrameTimer(const float newFrameTimer)
+{
+   frameTimer         = newFrameTimer;
    previousFrameIndex = currentFrameIndex;
 
+   if (m_frames.empty())
+      return false;
+
    while (frameTimer >= m_frames[currentFrameIndex].getDuration())
    {
       frameTimer -= m_frames[currentFrameIndex].getDuration();
@@ -58,11 +104,38 @@ void Animation::update(const float deltaTime)
             currentFrameIndex = m_frames.size() - 1; // Stop at last frame
       }
    }
+
+   if (m_deltaEncoded)
+   {
+      decodeFrame(currentFrameIndex);
+   }
+   else if (m_stream != nullptr)
+   {
+      fetchStreamedFrame(false);
+   }
+
+   return currentFrameIndex != previousFrameIndex;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+float Animation::getFrameTimer() const
+{
+   return frameTimer;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+float Animation::getCurrentFrameDuration() const
+{
+   if (m_frames.empty())
+      return 0.0f;
+
+   return m_frames[currentFrameIndex].getDuration();
 };
 
 // public ----------------------------------------------------------------------------------------------------
 void Animation::manuallyIncrementFrame()
 {
+   touchTiming();
    previousFrameIndex = currentFrameIndex;
    currentFrameIndex++;
    if (currentFrameIndex >= m_frames.size())
@@ -72,11 +145,21 @@ void Animation::manuallyIncrementFrame()
       else
          currentFrameIndex = m_frames.size() - 1; // Stop at last frame
    }
+
+   if (m_deltaEncoded)
+   {
+      decodeFrame(currentFrameIndex);
+   }
+   else if (m_stream != nullptr)
+   {
+      fetchStreamedFrame(true);
+   }
 };
 
 // public ----------------------------------------------------------------------------------------------------
 void Animation::manuallyDecrementFrame()
 {
+   touchTiming();
    previousFrameIndex = currentFrameIndex;
    if (currentFrameIndex == 0)
    {
@@ -89,23 +172,48 @@ void Animation::manuallyDecrementFrame()
    {
       --currentFrameIndex;
    }
+
+   if (m_deltaEncoded)
+   {
+      decodeFrame(currentFrameIndex);
+   }
+   else if (m_stream != nullptr)
+   {
+      fetchStreamedFrame(true);
+   }
 };
 
 // public ----------------------------------------------------------------------------------------------------
 const Sprite& Animation::getCurrentFrameSprite() const
 {
+   if (m_deltaEncoded)
+      return m_decodedSprite;
+   if (m_stream != nullptr)
+      return m_streamedFrame.getSprite();
+
    return m_frames[currentFrameIndex].getSprite();
 };
 
 // public ----------------------------------------------------------------------------------------------------
 Sprite& Animation::getCurrentFrameSpriteMutable()
 {
+   if (m_deltaEncoded)
+      return m_decodedSprite;
+   if (m_stream != nullptr)
+      return m_streamedFrame.getMutableSprite();
+
    return m_frames[currentFrameIndex].getMutableSprite();
 };
 
 // public ----------------------------------------------------------------------------------------------------
 const Sprite& Animation::getPreviousFrameSprite() const
 {
+   // Delta frames have no sprite of their own, the vacated positions cover erasing
+   if (m_deltaEncoded)
+      return m_decodedSprite;
+   if (m_stream != nullptr)
+      return m_previousStreamedFrame.getSprite();
+
    return m_frames[previousFrameIndex].getSprite();
 };
 
@@ -128,12 +236,28 @@ void Animation::displace(const int dx, const int dy)
    {
       frame.displace(dx, dy);
    }
+
+   if (m_deltaEncoded)
+   {
+      m_decodedSprite.displace(dx, dy);
+      indexDecodedSprite();
+   }
+
+   // Frames still to come from the stream are displaced as they are taken
+   m_streamedFrame.displace(dx, dy);
+   m_previousStreamedFrame.displace(dx, dy);
+   m_offsetX += dx;
+   m_offsetY += dy;
 };
 
 // public ----------------------------------------------------------------------------------------------------
 void Animation::setPlaying(const bool playing)
 {
-   m_playing = playing;
+   if (m_playing != playing)
+   {
+      m_playing = playing;
+      touchTiming();
+   }
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -145,6 +269,18 @@ const bool& Animation::isPlaying() const
 // public ----------------------------------------------------------------------------------------------------
 void Animation::addPixelToCurrentFrame(const Pixel pixel)
 {
+   if (m_deltaEncoded)
+   {
+      m_decodedCells[cellKey(pixel.getPosition())] = m_decodedSprite.getPixels().size();
+      m_decodedSprite.addPixel(pixel);
+      return;
+   }
+   if (m_stream != nullptr)
+   {
+      m_streamedFrame.getMutableSprite().addPixel(pixel);
+      return;
+   }
+
    m_frames[currentFrameIndex].getMutableSprite().addPixel(pixel);
 };
 
@@ -155,6 +291,9 @@ void Animation::setAllSpriteLayers(const int layer)
    {
       frame.getMutableSprite().setLayer(layer);
    }
+   m_decodedSprite.setLayer(layer);
+   m_streamedFrame.getMutableSprite().setLayer(layer);
+   m_previousStreamedFrame.getMutableSprite().setLayer(layer);
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -173,6 +312,55 @@ size_t Animation::getTotalFrames() const
 void Animation::addFrame(const Frame& frame)
 {
    m_frames.push_back(frame);
+   touchTiming();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::replaceFrame(const size_t index, Frame frame)
+{
+   if (index >= m_frames.size() || m_stream != nullptr)
+      return;
+
+   touchTiming();
+   frame.displace(m_offsetX, m_offsetY);
+   if (!m_deltaEncoded)
+   {
+      m_frames[index] = std::move(frame);
+      return;
+   }
+
+   // Deltas on both sides of the frame change, re-encode from full frames
+   size_t keyframeInterval = m_keyframeInterval;
+   decodeDeltas();
+   m_frames[index] = std::move(frame);
+   encodeDeltas(keyframeInterval);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::replaceFrames(std::vector<Frame> frames)
+{
+   if (m_stream != nullptr)
+      return;
+
+   touchTiming();
+   size_t keyframeInterval = m_deltaEncoded ? m_keyframeInterval : 0;
+   decodeDeltas();
+   m_frames = std::move(frames);
+   for (Frame& frame : m_frames)
+   {
+      frame.displace(m_offsetX, m_offsetY);
+   }
+
+   if (currentFrameIndex >= m_frames.size())
+   {
+      currentFrameIndex = 0;
+      frameTimer        = 0.0f;
+   }
+   if (previousFrameIndex >= m_frames.size())
+   {
+      previousFrameIndex = currentFrameIndex;
+   }
+   encodeDeltas(keyframeInterval);
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -200,6 +388,8 @@ const Frame& Animation::getFrameAtIndex(size_t index) const
 // public ----------------------------------------------------------------------------------------------------
 Frame& Animation::getFrameAtIndexMutable(size_t index)
 {
+   // The caller may change the frame's duration
+   touchTiming();
    if (index >= m_frames.size())
    {
       return m_frames[0];
@@ -210,11 +400,278 @@ Frame& Animation::getFrameAtIndexMutable(size_t index)
 // public ----------------------------------------------------------------------------------------------------
 void Animation::setRepeats(const bool repeats)
 {
-   m_repeats = repeats;
+   if (m_repeats != repeats)
+   {
+      m_repeats = repeats;
+      touchTiming();
+   }
 };
 
 // public ----------------------------------------------------------------------------------------------------
 const bool& Animation::getRepeats() const
 {
    return m_repeats;
-};
\ No newline at end of file
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::encodeDeltas(const size_t keyframeInterval)
+{
+   decodeDeltas();
+   if (keyframeInterval == 0 || m_frames.empty() || m_stream != nullptr)
+      return;
+
+   // Walk backwards so the previous frame still holds its full sprite when each delta is built
+   for (size_t i = m_frames.size(); i-- > 1;)
+   {
+      if (i % keyframeInterval == 0)
+         continue;
+
+      const std::vector<Pixel>& previous = m_frames[i - 1].getSprite().getPixels();
+      const std::vector<Pixel>& current  = m_frames[i].getSprite().getPixels();
+
+      std::unordered_map<int64_t, size_t> previousCells;
+      previousCells.reserve(previous.size());
+      for (size_t j = 0; j < previous.size(); j++)
+      {
+         previousCells[cellKey(previous[j].getPosition())] = j;
+      }
+
+      std::vector<Pixel>    changedPixels;
+      std::vector<Position> clearedPositions;
+      for (const Pixel& pixel : current)
+      {
+         auto found = previousCells.find(cellKey(pixel.getPosition()));
+         if (found == previousCells.end())
+         {
+            changedPixels.push_back(pixel);
+            continue;
+         }
+         if (!samePixel(previous[found->second], pixel))
+         {
+            changedPixels.push_back(pixel);
+         }
+         previousCells.erase(found);
+      }
+
+      // Whatever is left was only in the previous frame
+      for (const auto& entry : previousCells)
+      {
+         clearedPositions.push_back(previous[entry.second].getPosition());
+      }
+
+      m_frames[i].setDelta(changedPixels, clearedPositions);
+   }
+
+   m_deltaEncoded      = true;
+   m_keyframeInterval  = keyframeInterval;
+   m_decodedSprite     = Sprite();
+   m_decodedFrameIndex = 0;
+   applyDelta(m_frames[0]);
+   decodeFrame(currentFrameIndex);
+   m_vacatedPositions.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::decodeDeltas()
+{
+   if (!m_deltaEncoded)
+      return;
+
+   m_decodedSprite     = Sprite();
+   m_decodedFrameIndex = 0;
+   applyDelta(m_frames[0]);
+   for (size_t i = 1; i < m_frames.size(); i++)
+   {
+      decodeFrame(i);
+      if (!m_frames[i].isKeyframe())
+      {
+         m_frames[i].setSprite(m_decodedSprite);
+      }
+   }
+
+   m_deltaEncoded      = false;
+   m_decodedSprite     = Sprite();
+   m_decodedFrameIndex = 0;
+   m_decodedCells.clear();
+   m_vacatedPositions.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool Animation::isDeltaEncoded() const
+{
+   return m_deltaEncoded;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<Position>& Animation::getVacatedPositions() const
+{
+   return m_vacatedPositions;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::clearVacatedPositions()
+{
+   m_vacatedPositions.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Animation::setStream(std::shared_ptr<FrameStream> stream)
+{
+   touchTiming();
+   decodeDeltas();
+   m_stream                = std::move(stream);
+   m_streamedFrame         = Frame();
+   m_previousStreamedFrame = Frame();
+   m_offsetX               = 0;
+   m_offsetY               = 0;
+   if (m_stream == nullptr || m_frames.empty())
+      return;
+
+   m_streamedFrameIndex = m_frames.size(); // Nothing taken yet
+   fetchStreamedFrame(true);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::shared_ptr<FrameStream>& Animation::getStream() const
+{
+   return m_stream;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+uint64_t Animation::getTimingVersion() const
+{
+   return m_timingVersion;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void Animation::touchTiming()
+{
+   m_timingVersion = ++nextTimingVersion;
+   animationTrackingVersion++;
+};
+
+// private static --------------------------------------------------------------------------------------------
+int64_t Animation::cellKey(const Position& position)
+{
+   return (static_cast<int64_t>(position.getY()) << 32) ^ static_cast<uint32_t>(position.getX());
+};
+
+// private static --------------------------------------------------------------------------------------------
+bool Animation::samePixel(const Pixel& a, const Pixel& b)
+{
+   return a.getCharacter() == b.getCharacter() && a.getAttributes() == b.getAttributes() &&
+          a.getTextColor().getR() == b.getTextColor().getR() &&
+          a.getTextColor().getG() == b.getTextColor().getG() &&
+          a.getTextColor().getB() == b.getTextColor().getB() &&
+          a.getBackgroundColor().getR() == b.getBackgroundColor().getR() &&
+          a.getBackgroundColor().getG() == b.getBackgroundColor().getG() &&
+          a.getBackgroundColor().getB() == b.getBackgroundColor().getB();
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void Animation::decodeFrame(const size_t index)
+{
+   if (index >= m_frames.size() || index == m_decodedFrameIndex)
+      return;
+
+   size_t keyframe = index;
+   while (keyframe > 0 && !m_frames[keyframe].isKeyframe())
+   {
+      keyframe--;
+   }
+
+   // Patch forward from the decoded frame when possible, otherwise restart at the keyframe
+   size_t next = m_decodedFrameIndex + 1;
+   if (index < m_decodedFrameIndex || m_decodedFrameIndex < keyframe)
+   {
+      next = keyframe;
+   }
+
+   for (; next <= index; next++)
+   {
+      applyDelta(m_frames[next]);
+   }
+   m_decodedFrameIndex = index;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void Animation::applyDelta(const Frame& frame)
+{
+   if (frame.isKeyframe())
+   {
+      for (const Pixel& pixel : m_decodedSprite.getPixels())
+      {
+         m_vacatedPositions.push_back(pixel.getPosition());
+      }
+      m_decodedSprite = frame.getSprite();
+      indexDecodedSprite();
+      return;
+   }
+
+   std::vector<Pixel>& pixels = m_decodedSprite.getPixelsMutable();
+   for (const Position& position : frame.getClearedPositions())
+   {
+      auto found = m_decodedCells.find(cellKey(position));
+      if (found == m_decodedCells.end())
+         continue;
+
+      // Swap the last pixel into the freed slot
+      size_t index = found->second;
+      size_t last  = pixels.size() - 1;
+      m_decodedCells.erase(found);
+      if (index != last)
+      {
+         pixels[index]                                      = pixels[last];
+         m_decodedCells[cellKey(pixels[index].getPosition())] = index;
+      }
+      pixels.pop_back();
+      m_vacatedPositions.push_back(position);
+   }
+
+   for (const Pixel& pixel : frame.getChangedPixels())
+   {
+      auto found = m_decodedCells.find(cellKey(pixel.getPosition()));
+      if (found != m_decodedCells.end())
+      {
+         pixels[found->second] = pixel;
+      }
+      else
+      {
+         m_decodedCells[cellKey(pixel.getPosition())] = pixels.size();
+         pixels.push_back(pixel);
+      }
+   }
+
+   m_decodedSprite.setAnchor(frame.getSprite().getAnchor());
+   m_decodedSprite.setLayer(frame.getSprite().getLayer());
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void Animation::indexDecodedSprite()
+{
+   const std::vector<Pixel>& pixels = m_decodedSprite.getPixels();
+
+   m_decodedCells.clear();
+   m_decodedCells.reserve(pixels.size());
+   for (size_t i = 0; i < pixels.size(); i++)
+   {
+      m_decodedCells[cellKey(pixels[i].getPosition())] = i;
+   }
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void Animation::fetchStreamedFrame(const bool wait)
+{
+   if (currentFrameIndex == m_streamedFrameIndex)
+      return;
+
+   Frame frame;
+   if (!m_stream->takeFrame(currentFrameIndex, frame, wait))
+      return;
+
+   frame.displace(m_offsetX, m_offsetY);
+   frame.getMutableSprite().setLayer(m_frames[currentFrameIndex].getSprite().getLayer());
+   m_previousStreamedFrame = std::move(m_streamedFrame);
+   m_streamedFrame         = std::move(frame);
+   m_streamedFrameIndex    = currentFrameIndex;
+};
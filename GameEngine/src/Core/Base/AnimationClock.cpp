@@ -0,0 +1,229 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationClock.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationClock class for scheduled animation frame changes
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/AnimationClock.h"
+#include <algorithm>
+#include <limits>
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationClock::AnimationClock()
+{
+   m_now            = 0.0;
+   m_nextGeneration = 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationClock::clear()
+{
+   m_animations.clear();
+   m_owners.clear();
+   m_syncTimes.clear();
+   m_wakeTimes.clear();
+   m_frameIndices.clear();
+   m_timingVersions.clear();
+   m_generations.clear();
+   m_seen.clear();
+   m_slots.clear();
+   m_wakeHeap.clear();
+   m_changedPrintables.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationClock::beginTracking()
+{
+   std::fill(m_seen.begin(), m_seen.end(), 0);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationClock::track(Printable* owner, Animation* animation)
+{
+   auto found = m_slots.find(animation);
+   if (found != m_slots.end() && m_owners[found->second] == owner)
+   {
+      size_t slot  = found->second;
+      m_seen[slot] = 1;
+
+      // Frame or timer was changed from outside the clock (manual stepping, replaced frames, restarts), the
+      // old wake time no longer applies
+      if (animation->getTimingVersion() != m_timingVersions[slot])
+      {
+         sync(slot);
+         schedule(slot);
+      }
+      return;
+   }
+
+   if (found != m_slots.end())
+   {
+      removeSlot(found->second);
+   }
+
+   size_t slot = m_animations.size();
+   m_animations.push_back(animation);
+   m_owners.push_back(owner);
+   m_syncTimes.push_back(m_now);
+   m_wakeTimes.push_back(m_now);
+   m_frameIndices.push_back(animation->getCurrentFrameIndex());
+   m_timingVersions.push_back(animation->getTimingVersion());
+   m_generations.push_back(++m_nextGeneration);
+   m_seen.push_back(1);
+   m_slots[animation] = slot;
+
+   schedule(slot);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationClock::endTracking()
+{
+   // Drop animations that stopped, were hidden or removed
+   for (size_t slot = m_animations.size(); slot-- > 0;)
+   {
+      if (!m_seen[slot])
+      {
+         removeSlot(slot);
+      }
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationClock::advance(const float deltaTime)
+{
+   m_changedPrintables.clear();
+
+   m_now += deltaTime;
+
+   // Only animations whose frame change is due get stepped, everything else stays asleep
+   while (!m_wakeHeap.empty() && m_wakeHeap.front().wakeTime <= m_now)
+   {
+      WakeEvent event = m_wakeHeap.front();
+      std::pop_heap(m_wakeHeap.begin(), m_wakeHeap.end(), wakesLater);
+      m_wakeHeap.pop_back();
+
+      if (event.slot >= m_animations.size() || m_generations[event.slot] != event.generation)
+      {
+         continue;
+      }
+
+      if (sync(event.slot))
+      {
+         m_changedPrintables.push_back(m_owners[event.slot]);
+      }
+      schedule(event.slot);
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<Printable*>& AnimationClock::getChangedPrintables() const
+{
+   return m_changedPrintables;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+float AnimationClock::getTimeUntilNextChange()
+{
+   // Discard stale entries so the top of the heap is a real wake time
+   while (!m_wakeHeap.empty())
+   {
+      const WakeEvent& event = m_wakeHeap.front();
+      if (event.slot < m_animations.size() && m_generations[event.slot] == event.generation)
+      {
+         return static_cast<float>(std::max(0.0, event.wakeTime - m_now));
+      }
+      std::pop_heap(m_wakeHeap.begin(), m_wakeHeap.end(), wakesLater);
+      m_wakeHeap.pop_back();
+   }
+   return std::numeric_limits<float>::infinity();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t AnimationClock::size() const
+{
+   return m_animations.size();
+};
+
+// private static --------------------------------------------------------------------------------------------
+bool AnimationClock::wakesLater(const WakeEvent& a, const WakeEvent& b)
+{
+   // Min-heap ordering on wake time
+   return a.wakeTime > b.wakeTime;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void AnimationClock::schedule(const size_t slot)
+{
+   const Animation* animation = m_animations[slot];
+
+   m_generations[slot]    = ++m_nextGeneration;
+   m_frameIndices[slot]   = animation->getCurrentFrameIndex();
+   m_timingVersions[slot] = animation->getTimingVersion();
+
+   // Single frame animations and finished non-repeating ones never change frame again
+   size_t totalFrames = animation->getTotalFrames();
+   bool   finished    = !animation->getRepeats() && m_frameIndices[slot] + 1 >= totalFrames;
+   if (totalFrames <= 1 || finished)
+   {
+      m_wakeTimes[slot] = std::numeric_limits<double>::infinity();
+      return;
+   }
+
+   double remaining  = animation->getCurrentFrameDuration() - animation->getFrameTimer();
+   m_wakeTimes[slot] = m_syncTimes[slot] + std::max(0.0, remaining);
+
+   m_wakeHeap.push_back({m_wakeTimes[slot], slot, m_generations[slot]});
+   std::push_heap(m_wakeHeap.begin(), m_wakeHeap.end(), wakesLater);
+};
+
+// private ---------------------------------------------------------------------------------------------------
+bool AnimationClock::sync(const size_t slot)
+{
+   Animation* animation = m_animations[slot];
+   float      elapsed   = static_cast<float>(m_now - m_syncTimes[slot]);
+
+   m_syncTimes[slot] = m_now;
+   return animation->applyFrameTimer(animation->getFrameTimer() + elapsed);
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void AnimationClock::removeSlot(const size_t slot)
+{
+   size_t last = m_animations.size() - 1;
+
+   m_slots.erase(m_animations[slot]);
+   if (slot != last)
+   {
+      m_animations[slot]     = m_animations[last];
+      m_owners[slot]         = m_owners[last];
+      m_syncTimes[slot]      = m_syncTimes[last];
+      m_wakeTimes[slot]      = m_wakeTimes[last];
+      m_frameIndices[slot]   = m_frameIndices[last];
+      m_timingVersions[slot] = m_timingVersions[last];
+      m_generations[slot]    = ++m_nextGeneration;
+      m_seen[slot]           = m_seen[last];
+
+      m_slots[m_animations[slot]] = slot;
+
+      // The moved entry's heap event points at the old slot, queue it again under the new one
+      if (m_wakeTimes[slot] != std::numeric_limits<double>::infinity())
+      {
+         m_wakeHeap.push_back({m_wakeTimes[slot], slot, m_generations[slot]});
+         std::push_heap(m_wakeHeap.begin(), m_wakeHeap.end(), wakesLater);
+      }
+   }
+
+   m_animations.pop_back();
+   m_owners.pop_back();
+   m_syncTimes.pop_back();
+   m_wakeTimes.pop_back();
+   m_frameIndices.pop_back();
+   m_timingVersions.pop_back();
+   m_generations.pop_back();
+   m_seen.pop_back();
+};
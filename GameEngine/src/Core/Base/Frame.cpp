@@ -10,19 +10,22 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../../../include/Frame.h"
+#include <utility>
 
 // public ----------------------------------------------------------------------------------------------------
 Frame::Frame()
 {
    m_sprite            = Sprite();
    m_durationInSeconds = 1.0f;
+   m_keyframe          = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
-Frame::Frame(const Sprite sprite, const float duration)
+Frame::Frame(Sprite sprite, const float duration)
 {
-   m_sprite            = sprite;
+   m_sprite            = std::move(sprite);
    m_durationInSeconds = duration;
+   m_keyframe          = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -46,11 +49,52 @@ Sprite& Frame::getMutableSprite()
 // public ----------------------------------------------------------------------------------------------------
 void Frame::setSprite(Sprite sprite)
 {
-   m_sprite = sprite;
+   m_sprite   = sprite;
+   m_keyframe = true;
+   m_changedPixels.clear();
+   m_clearedPositions.clear();
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void Frame::setDelta(const std::vector<Pixel> changedPixels, const std::vector<Position> clearedPositions)
+{
+   m_keyframe         = false;
+   m_changedPixels    = changedPixels;
+   m_clearedPositions = clearedPositions;
+
+   // Anchor and layer stay on the sprite, setPixels would recompute the anchor
+   m_sprite.getPixelsMutable().clear();
+   m_sprite.getPixelsMutable().shrink_to_fit();
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool Frame::isKeyframe() const
+{
+   return m_keyframe;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<Pixel>& Frame::getChangedPixels() const
+{
+   return m_changedPixels;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<Position>& Frame::getClearedPositions() const
+{
+   return m_clearedPositions;
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void Frame::displace(const int dx, const int dy)
 {
    m_sprite.displace(dx, dy);
+   for (Pixel& pixel : m_changedPixels)
+   {
+      pixel.displace(dx, dy);
+   }
+   for (Position& position : m_clearedPositions)
+   {
+      position = Position(position.getX() + dx, position.getY() + dy);
+   }
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include "../../../include/Printable.h"
 #include "../../../include/Animation.h"
+#include "../../../include/Parameters.h"
 
 // public ----------------------------------------------------------------------------------------------------
 Printable::Printable()
@@ -18,14 +19,16 @@ Printable::Printable()
    m_currentAnimationName = "default";
    m_animations.push_back(Animation());
    m_visable       = false;
-   m_printableName = "default";
-   m_ncurseWindow  = nullptr;
+   m_printableName        = "default";
+   m_ncurseWindow         = nullptr;
+   m_backgroundOverridden = false;
 };
 
 // public ----------------------------------------------------------------------------------------------------
 void Printable::addAnimation(const Animation animation)
 {
    m_animations.push_back(animation);
+   animationTrackingVersion++;
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -35,7 +38,11 @@ bool Printable::setCurrentAnimation(const std::string name)
    {
       if (animation.getAnimationName() == name)
       {
-         m_currentAnimationName = animation.getAnimationName();
+         if (m_currentAnimationName != name)
+         {
+            m_currentAnimationName = name;
+            animationTrackingVersion++;
+         }
          return true;
       }
    }
@@ -74,6 +81,23 @@ void Printable::displace(const int dx, const int dy)
    }
 };
 
+// public ----------------------------------------------------------------------------------------------------
+bool Printable::drawToWindow(NcursesWindow& /* window */, const float /* deltaTime */)
+{
+   return false;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void Printable::eraseBatched(NcursesWindow& /* window */)
+{
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool Printable::isBatched() const
+{
+   return false;
+};
+
 // public ----------------------------------------------------------------------------------------------------
 bool Printable::isVisable() const
 {
@@ -83,7 +107,11 @@ bool Printable::isVisable() const
 // public ----------------------------------------------------------------------------------------------------
 void Printable::setVisability(const bool visable)
 {
-   m_visable = visable;
+   if (m_visable != visable)
+   {
+      m_visable = visable;
+      animationTrackingVersion++;
+   }
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -143,6 +171,7 @@ void Printable::moveToPosition(const Position position)
    {
       animation.getCurrentFrameSpriteMutable().moveAnchorToPosition(position);
    }
+   uiLayoutVersion++;
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -182,4 +211,36 @@ WINDOW* Printable::getNcurseWindow() const
 void Printable::setNcurseWindow(WINDOW* window)
 {
    m_ncurseWindow = window;
+   uiLayoutVersion++;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void Printable::setBackgroundOverride(const RGB& color)
+{
+   m_backgroundOverridden = true;
+   m_overrideBackground   = color;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void Printable::clearBackgroundOverride()
+{
+   m_backgroundOverridden = false;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool Printable::hasBackgroundOverride() const
+{
+   return m_backgroundOverridden;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+const RGB& Printable::getBackgroundOverride() const
+{
+   return m_overrideBackground;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool Printable::keepsOwnBackground(const size_t /* pixelIndex */) const
+{
+   return false;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../../../include/Sprite.h"
+#include <utility>
 
 // public ----------------------------------------------------------------------------------------------------
 Sprite::Sprite()
@@ -28,9 +29,9 @@ Sprite::Sprite(const std::vector<Pixel> pixels)
 };
 
 // public ----------------------------------------------------------------------------------------------------
-Sprite::Sprite(const std::vector<Pixel> pixels, const int layer)
+Sprite::Sprite(std::vector<Pixel> pixels, const int layer)
 {
-   m_pixels = pixels;
+   m_pixels = std::move(pixels);
    m_layer  = layer;
    refreshAnchor();
 };
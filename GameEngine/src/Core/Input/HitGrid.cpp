@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file HitGrid.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of the HitGrid class
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/HitGrid.h"
+#include <algorithm>
+
+// public ----------------------------------------------------------------------------------------------------
+HitGrid::HitGrid(const int cellWidth, const int cellHeight)
+{
+   m_cellWidth  = std::max(1, cellWidth);
+   m_cellHeight = std::max(1, cellHeight);
+   m_columns    = 0;
+   m_rows       = 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void HitGrid::reset(const int screenWidth, const int screenHeight)
+{
+   m_columns = std::max(1, (screenWidth + m_cellWidth - 1) / m_cellWidth);
+   m_rows    = std::max(1, (screenHeight + m_cellHeight - 1) / m_cellHeight);
+
+   // Keep the bucket allocations, layouts are rebuilt with roughly the same elements each time
+   m_cells.resize(static_cast<size_t>(m_columns) * m_rows);
+   for (std::vector<size_t>& cell : m_cells)
+   {
+      cell.clear();
+   }
+   m_bounds.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void HitGrid::insert(const size_t id, const Position minPosition, const Position maxPosition)
+{
+   if (id >= m_bounds.size())
+   {
+      m_bounds.resize(id + 1, {0, 0, -1, -1});
+   }
+   m_bounds[id] = {minPosition.getX(), minPosition.getY(), maxPosition.getX(), maxPosition.getY()};
+
+   if (maxPosition.getX() < 0 || maxPosition.getY() < 0)
+   {
+      return;
+   }
+
+   int firstColumn = std::max(0, minPosition.getX()) / m_cellWidth;
+   int firstRow    = std::max(0, minPosition.getY()) / m_cellHeight;
+   int lastColumn  = std::min(m_columns - 1, maxPosition.getX() / m_cellWidth);
+   int lastRow     = std::min(m_rows - 1, maxPosition.getY() / m_cellHeight);
+
+   for (int row = firstRow; row <= lastRow; row++)
+   {
+      for (int column = firstColumn; column <= lastColumn; column++)
+      {
+         m_cells[static_cast<size_t>(row) * m_columns + column].push_back(id);
+      }
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<size_t>& HitGrid::query(const Position position)
+{
+   m_candidates.clear();
+
+   int x = position.getX();
+   int y = position.getY();
+   if (x < 0 || y < 0 || x / m_cellWidth >= m_columns || y / m_cellHeight >= m_rows)
+   {
+      return m_candidates;
+   }
+
+   // A cell is coarser than the boxes in it, drop the ids whose box misses the exact position
+   for (size_t id : m_cells[static_cast<size_t>(y / m_cellHeight) * m_columns + x / m_cellWidth])
+   {
+      const Bounds& bounds = m_bounds[id];
+      if (x >= bounds.minX && x <= bounds.maxX && y >= bounds.minY && y <= bounds.maxY)
+      {
+         m_candidates.push_back(id);
+      }
+   }
+   return m_candidates;
+};
@@ -13,6 +13,7 @@
 #include "../../../include/NcursesWindow.h"
 #include "../../../include/Parameters.h"
 #include <ncurses.h>
+#include <algorithm>
 #include <cstring>
 
 // public ----------------------------------------------------------------------------------------------------
@@ -30,30 +31,67 @@ InputHandler::InputHandler()
    currentHoveredButton      = nullptr;
    currentClickedButton      = nullptr;
    currentSelectedButton     = nullptr;
+   hitGridNeedsRebuilt       = true;
+   hitGridLayoutVersion      = 0;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void indexElement(HitGrid& grid, const size_t id, const UIElement& element)
+{
+   const std::vector<Pixel>& pixels = element.getCurrentAnimation().getCurrentFrameSprite().getPixels();
+   if (pixels.empty())
+   {
+      return;
+   }
+
+   // Sprites are stored relative to their window, mouse positions are screen coordinates
+   int     offsetX = 0;
+   int     offsetY = 0;
+   WINDOW* window  = element.getNcurseWindow();
+   if (window && window != stdscr)
+   {
+      getbegyx(window, offsetY, offsetX);
+   }
+
+   const Position& anchor = element.getCurrentAnimation().getCurrentFrameSprite().getAnchor();
+   int             maxX   = anchor.getX();
+   int             maxY   = anchor.getY();
+   for (const Pixel& pixel : pixels)
+   {
+      maxX = std::max(maxX, pixel.getPosition().getX());
+      maxY = std::max(maxY, pixel.getPosition().getY());
+   }
+
+   grid.insert(id, Position(anchor.getX() + offsetX, anchor.getY() + offsetY),
+               Position(maxX + offsetX, maxY + offsetY));
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void InputHandler::addButton(std::shared_ptr<Button> button)
 {
    buttons.push_back(button);
+   hitGridNeedsRebuilt = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void InputHandler::addSlider(std::shared_ptr<Slider> slider)
 {
    sliders.push_back(slider);
+   hitGridNeedsRebuilt = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void InputHandler::removeButton(std::shared_ptr<Button> button)
 {
    buttons.erase(std::remove(buttons.begin(), buttons.end(), button), buttons.end());
+   hitGridNeedsRebuilt = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void InputHandler::removeSlider(std::shared_ptr<Slider> slider)
 {
    sliders.erase(std::remove(sliders.begin(), sliders.end(), slider), sliders.end());
+   hitGridNeedsRebuilt = true;
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -103,63 +141,88 @@ bool InputHandler::isWindowInFocus(WINDOW* window) const
    return false;
 }
 
+// private ---------------------------------------------------------------------------------------------------
+const std::vector<size_t>& InputHandler::getCandidates(Position position)
+{
+   if (hitGridNeedsRebuilt || hitGridLayoutVersion != uiLayoutVersion ||
+       hitGridScreenSize.getX() != SCREEN_LENGTH || hitGridScreenSize.getY() != SCREEN_HEIGHT)
+   {
+      hitGrid.reset(SCREEN_LENGTH, SCREEN_HEIGHT);
+      for (size_t i = 0; i < sliders.size(); i++)
+      {
+         if (sliders[i])
+            indexElement(hitGrid, i, *sliders[i]);
+      }
+      for (size_t i = 0; i < buttons.size(); i++)
+      {
+         if (buttons[i])
+            indexElement(hitGrid, sliders.size() + i, *buttons[i]);
+      }
+      hitGridNeedsRebuilt  = false;
+      hitGridLayoutVersion = uiLayoutVersion;
+      hitGridScreenSize    = Position(SCREEN_LENGTH, SCREEN_HEIGHT);
+   }
+   return hitGrid.query(position);
+}
+
 // public ----------------------------------------------------------------------------------------------------
-bool InputHandler::processInput(int userInput)
+bool InputHandler::processInput(const InputEvent& inputEvent)
 {
    mouseEventProcessed = false; // Reset flag at start of processing
 
-   // Handle mouse input
-   if (userInput == KEY_MOUSE)
+   // Handle mouse input, getmouse was already called by the game loop
+   if (inputEvent.isMouse())
    {
-      if (getmouse(&event) == OK)
+      std::memset(&event, 0, sizeof(event));
+      event.x                = inputEvent.mousePosition.getX();
+      event.y                = inputEvent.mousePosition.getY();
+      event.bstate           = inputEvent.buttonState;
+      mouseEventProcessed    = true; // Mark that we processed a mouse event
+      Position mousePosition = Position(event.x, event.y);
+
+      // Handle mouse button press - use separate if statements, not else if
+      if (event.bstate & BUTTON1_PRESSED)
       {
-         mouseEventProcessed    = true; // Mark that we processed a mouse event
-         Position mousePosition = Position(event.x, event.y);
+         // Update button highlighting for mouse press
+         updateButtonHighlighting(mousePosition, true);
 
-         // Handle mouse button press - use separate if statements, not else if
-         if (event.bstate & BUTTON1_PRESSED)
+         // Check for window dragging first (takes precedence over UI elements)
+         if (handleWindowPress(mousePosition))
          {
-            // Update button highlighting for mouse press
-            updateButtonHighlighting(mousePosition, true);
-
-            // Check for window dragging first (takes precedence over UI elements)
-            if (handleWindowPress(mousePosition))
-            {
-               return true;
-            }
-
-            if (handleMousePress(mousePosition))
-            {
-               return true;
-            }
+            return true;
          }
 
-         // Handle mouse button release - use separate if statements, not else if
-         if (event.bstate & BUTTON1_RELEASED)
+         if (handleMousePress(mousePosition))
          {
-            // Update button highlighting for mouse release
-            updateButtonHighlighting(mousePosition, false);
-
-            handleWindowRelease();
-            handleMouseRelease();
+            return true;
          }
+      }
 
-         // Handle mouse click events (additional safety checks)
-         if (event.bstate & (BUTTON1_RELEASED | BUTTON1_CLICKED))
-         {
-            handleWindowRelease();
-            handleMouseRelease();
-         }
+      // Handle mouse button release - use separate if statements, not else if
+      if (event.bstate & BUTTON1_RELEASED)
+      {
+         // Update button highlighting for mouse release
+         updateButtonHighlighting(mousePosition, false);
 
-         // Handle mouse movement/dragging - use separate if statements, not else if
-         if (event.bstate & REPORT_MOUSE_POSITION)
-         {
-            // Update button highlighting for mouse movement
-            updateButtonHighlighting(mousePosition, false);
+         handleWindowRelease();
+         handleMouseRelease();
+      }
 
-            handleWindowDrag(mousePosition);
-            handleMouseDrag(mousePosition);
-         }
+      // Handle mouse click events (additional safety checks)
+      if (event.bstate & (BUTTON1_RELEASED | BUTTON1_CLICKED))
+      {
+         handleWindowRelease();
+         handleMouseRelease();
+      }
+
+      // Handle mouse movement/dragging - use separate if statements, not else if
+      if (event.bstate & REPORT_MOUSE_POSITION)
+      {
+         // Update button highlighting for mouse movement
+         updateButtonHighlighting(mousePosition, false);
+
+         handleWindowDrag(mousePosition);
+         handleMouseDrag(mousePosition);
       }
    }
 
@@ -169,33 +232,31 @@ bool InputHandler::processInput(int userInput)
 // private ---------------------------------------------------------------------------------------------------
 bool InputHandler::handleMousePress(Position mousePosition)
 {
-   // Check if mouse is over any slider
-   for (auto& slider : sliders)
+   // Candidates come back sliders first, so sliders still take precedence over buttons
+   for (size_t id : getCandidates(mousePosition))
    {
-      if (slider->mouseInBounds(mousePosition))
+      if (id < sliders.size())
       {
+         auto& slider = sliders[id];
+
          // Check if the slider's window is in focus
-         if (isWindowInFocus(slider->getNcurseWindow()))
+         if (slider->mouseInBounds(mousePosition) && isWindowInFocus(slider->getNcurseWindow()))
          {
             sliderDragging = true;
             draggedSlider  = slider;
             slider->setPositionFromMouse(mousePosition);
             return true;
          }
+         continue;
       }
-   }
 
-   // Check if mouse is over any button
-   for (auto& button : buttons)
-   {
-      if (button->mouseInBounds(mousePosition))
+      // Check if the button's window is in focus and the button has a function
+      auto& button = buttons[id - sliders.size()];
+      if (button->mouseInBounds(mousePosition) && isWindowInFocus(button->getNcurseWindow()) &&
+          button->hasFunction())
       {
-         // Check if the button's window is in focus and the button has a function
-         if (isWindowInFocus(button->getNcurseWindow()) && button->hasFunction())
-         {
-            pressedButton = button; // Record which button was pressed
-            return true;
-         }
+         pressedButton = button; // Record which button was pressed
+         return true;
       }
    }
 
@@ -235,6 +296,7 @@ void InputHandler::clear()
 {
    buttons.clear();
    sliders.clear();
+   hitGridNeedsRebuilt = true;
    sliderDragging = false;
    draggedSlider  = nullptr;
    windowDragging = false;
@@ -264,14 +326,10 @@ void InputHandler::clear()
 // public ----------------------------------------------------------------------------------------------------
 bool InputHandler::isMouseOverUI(Position mousePos)
 {
-   for (auto& button : buttons)
+   for (size_t id : getCandidates(mousePos))
    {
-      if (button->mouseInBounds(mousePos))
-         return true;
-   }
-   for (auto& slider : sliders)
-   {
-      if (slider->mouseInBounds(mousePos))
+      if (id < sliders.size() ? sliders[id]->mouseInBounds(mousePos)
+                              : buttons[id - sliders.size()]->mouseInBounds(mousePos))
          return true;
    }
    return false;
@@ -425,9 +483,15 @@ void InputHandler::updateButtonHighlighting(Position mousePosition, bool isMouse
 // private ---------------------------------------------------------------------------------------------------
 std::shared_ptr<Button> InputHandler::getButtonAtPosition(Position position)
 {
-   for (auto& button : buttons)
+   for (size_t id : getCandidates(position))
    {
-      if (button && button->isAutoHighlightEnabled() && button->isVisable() && button->mouseInBounds(position))
+      if (id < sliders.size())
+      {
+         continue;
+      }
+
+      auto& button = buttons[id - sliders.size()];
+      if (button->isAutoHighlightEnabled() && button->isVisable() && button->mouseInBounds(position))
       {
          // Check if the button's window is in focus and the button has a function
          if (isWindowInFocus(button->getNcurseWindow()) && button->hasFunction())
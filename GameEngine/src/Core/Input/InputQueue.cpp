@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputQueue.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of InputEvent and InputQueue
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/InputQueue.h"
+
+// Press, release and click bits of every button, modifiers and position reports left out
+static const mmask_t BUTTON_TRANSITIONS =
+      ALL_MOUSE_EVENTS & ~(REPORT_MOUSE_POSITION | BUTTON_SHIFT | BUTTON_CTRL | BUTTON_ALT);
+
+// Buttons that are held between a press and a release, the wheel (buttons 4 and 5) only sends presses
+static const mmask_t HELD_PRESSES[]  = {BUTTON1_PRESSED, BUTTON2_PRESSED, BUTTON3_PRESSED};
+static const mmask_t HELD_RELEASES[] = {BUTTON1_RELEASED | BUTTON1_CLICKED,
+                                        BUTTON2_RELEASED | BUTTON2_CLICKED,
+                                        BUTTON3_RELEASED | BUTTON3_CLICKED};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InputEvent::isMouse() const
+{
+   return key == KEY_MOUSE;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InputEvent::isMotionOnly() const
+{
+   return isMouse() && (buttonState & REPORT_MOUSE_POSITION) && !(buttonState & BUTTON_TRANSITIONS);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+InputQueue::InputQueue()
+{
+   m_heldButtons = 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InputQueue::push(InputEvent event)
+{
+   if (!event.isMouse())
+   {
+      event.heldButtons = m_heldButtons;
+      m_events.push_back(event);
+      return;
+   }
+
+   for (size_t i = 0; i < sizeof(HELD_PRESSES) / sizeof(HELD_PRESSES[0]); i++)
+   {
+      if (event.buttonState & HELD_PRESSES[i])
+         m_heldButtons |= HELD_PRESSES[i];
+      if (event.buttonState & HELD_RELEASES[i])
+         m_heldButtons &= ~HELD_PRESSES[i];
+   }
+   event.heldButtons = m_heldButtons;
+
+   // Hover motion only matters where it ends, a drag keeps every reported cell
+   if (event.isMotionOnly() && m_heldButtons == 0 && !m_events.empty() && m_events.back().isMotionOnly() &&
+       m_events.back().heldButtons == 0)
+   {
+      m_events.back() = event;
+      return;
+   }
+   m_events.push_back(event);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InputQueue::clear()
+{
+   m_events.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<InputEvent>& InputQueue::getEvents() const
+{
+   return m_events;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+mmask_t InputQueue::getHeldButtons() const
+{
+   return m_heldButtons;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+std::vector<InputEvent>::const_iterator InputQueue::begin() const
+{
+   return m_events.begin();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+std::vector<InputEvent>::const_iterator InputQueue::end() const
+{
+   return m_events.end();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t InputQueue::size() const
+{
+   return m_events.size();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InputQueue::empty() const
+{
+   return m_events.empty();
+};
@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputRecorder.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of the InputRecorder class
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/InputRecorder.h"
+#include "../../../include/Display.h"
+#include "../../../include/Parameters.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct RecordedFrame
+{
+   float                   deltaTime;
+   uint64_t                hash;
+   std::vector<InputEvent> events; // Timestamps relative to the start of the recording
+};
+
+// Recording state
+static std::ofstream     recordFile;
+static bool              recording = false;
+static bool              headerWritten;
+static Clock::time_point recordStart;
+
+// Replay state
+static std::vector<RecordedFrame> replayFrames;
+static bool                       replaying = false;
+static bool                       replayRealTime;
+static size_t                     replayFrame; // Index of the frame being replayed, one past it when done
+static float                      replayElapsed; // Recorded seconds up to the current frame
+static Clock::time_point          replayStart;
+static size_t                     mismatchCount = 0;
+static size_t                     firstMismatch;
+
+// private static --------------------------------------------------------------------------------------------
+static long long microsecondsSince(const Clock::time_point start, const Clock::time_point time)
+{
+   return std::chrono::duration_cast<std::chrono::microseconds>(time - start).count();
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool readRecording(const std::string& path, int& columns, int& rows, unsigned int& seed)
+{
+   std::ifstream in(path);
+   std::string   line;
+   std::string   tag;
+   int           version = 0;
+   if (!std::getline(in, line) || !(std::istringstream(line) >> tag >> version >> columns >> rows >> seed) ||
+       tag != "recording" || version != InputRecorder::VERSION)
+   {
+      return false;
+   }
+
+   while (std::getline(in, line))
+   {
+      std::istringstream frameLine(line);
+      std::string        deltaTime;
+      size_t             eventCount = 0;
+      RecordedFrame      frame;
+      if (!(frameLine >> tag >> deltaTime >> std::hex >> frame.hash >> std::dec >> eventCount) ||
+          tag != "frame")
+      {
+         return false;
+      }
+
+      // Written as a hex float so the replayed frame runs with exactly the recorded value
+      frame.deltaTime = std::strtof(deltaTime.c_str(), nullptr);
+      for (size_t i = 0; i < eventCount; i++)
+      {
+         long long     microseconds = 0;
+         int           key = 0, x = 0, y = 0;
+         unsigned long buttons = 0;
+         if (!std::getline(in, line) ||
+             !(std::istringstream(line) >> microseconds >> key >> x >> y >> std::hex >> buttons))
+         {
+            return false;
+         }
+         frame.events.push_back({key, Position(x, y), static_cast<mmask_t>(buttons), 0,
+                                 Clock::time_point(std::chrono::microseconds(microseconds))});
+      }
+      replayFrames.push_back(std::move(frame));
+   }
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputRecorder::startRecording(const std::string& path)
+{
+   stop();
+   recordFile.open(path, std::ios::trunc);
+   if (!recordFile)
+   {
+      std::cerr << "Failed to open input recording: " << path << std::endl;
+      return false;
+   }
+
+   // A fixed seed keeps random effects identical when the recording is replayed
+   if (randomSeed == 0)
+      randomSeed = std::random_device{}() | 1;
+
+   recording     = true;
+   headerWritten = false;
+   recordStart   = Clock::now();
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputRecorder::startReplay(const std::string& path, const bool realTime)
+{
+   stop();
+   int          columns = 0, rows = 0;
+   unsigned int seed    = 0;
+   replayFrames.clear();
+   if (!readRecording(path, columns, rows, seed))
+   {
+      std::cerr << "Invalid input recording: " << path << std::endl;
+      replayFrames.clear();
+      return false;
+   }
+
+   // ncurses sizes the screen from these when it is created, overriding the terminal
+   setenv("COLUMNS", std::to_string(columns).c_str(), 1);
+   setenv("LINES", std::to_string(rows).c_str(), 1);
+   randomSeed = seed;
+
+   replaying      = true;
+   replayRealTime = realTime;
+   replayFrame    = 0;
+   replayElapsed  = 0.0f;
+   mismatchCount  = 0;
+   firstMismatch  = 0;
+   replayStart    = Clock::now();
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+void InputRecorder::stop()
+{
+   if (recording)
+   {
+      recordFile.close();
+      recording = false;
+   }
+
+   if (replaying)
+   {
+      double seconds = std::chrono::duration<double>(Clock::now() - replayStart).count();
+      size_t frames  = std::min(replayFrame, replayFrames.size());
+      std::cerr << "Replayed " << frames << " of " << replayFrames.size() << " frames in " << seconds * 1000.0
+                << " ms, " << mismatchCount << " framebuffer mismatches";
+      if (mismatchCount > 0)
+         std::cerr << ", first at frame " << firstMismatch;
+      std::cerr << std::endl;
+
+      replayFrames.clear();
+      replaying = false;
+   }
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputRecorder::isRecording()
+{
+   return recording;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputRecorder::isReplaying()
+{
+   return replaying;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+float InputRecorder::beginFrame(const float deltaTime)
+{
+   if (!replaying)
+      return deltaTime;
+
+   if (replayFrame >= replayFrames.size())
+   {
+      engineRunning = false;
+      return 0.0f;
+   }
+
+   const RecordedFrame& frame = replayFrames[replayFrame];
+   replayElapsed += frame.deltaTime;
+   if (replayRealTime)
+   {
+      std::this_thread::sleep_until(replayStart + std::chrono::duration_cast<Clock::duration>(
+                                                        std::chrono::duration<float>(replayElapsed)));
+   }
+   return frame.deltaTime;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputRecorder::readFrameInput(InputQueue& queue)
+{
+   if (!replaying || replayFrame >= replayFrames.size())
+      return false;
+
+   const RecordedFrame& frame = replayFrames[replayFrame];
+   for (InputEvent event : frame.events)
+   {
+      event.timestamp = replayStart + (event.timestamp - Clock::time_point());
+      queue.push(event);
+   }
+   return !frame.events.empty();
+}
+
+// public static ---------------------------------------------------------------------------------------------
+void InputRecorder::endFrame(const InputQueue& events, const float deltaTime)
+{
+   if (recording)
+   {
+      if (!headerWritten)
+      {
+         recordFile << "recording " << VERSION << ' ' << SCREEN_LENGTH << ' ' << SCREEN_HEIGHT << ' '
+                    << randomSeed << '\n';
+         headerWritten = true;
+      }
+
+      recordFile << "frame " << std::hexfloat << deltaTime << std::defaultfloat << ' ' << std::hex
+                 << Display::hashFrameBuffers() << std::dec << ' ' << events.size() << '\n';
+      for (const InputEvent& event : events)
+      {
+         recordFile << microsecondsSince(recordStart, event.timestamp) << ' ' << event.key << ' '
+                    << event.mousePosition.getX() << ' ' << event.mousePosition.getY() << ' ' << std::hex
+                    << static_cast<unsigned long>(event.buttonState) << std::dec << '\n';
+      }
+   }
+
+   if (replaying && replayFrame < replayFrames.size())
+   {
+      if (Display::hashFrameBuffers() != replayFrames[replayFrame].hash && mismatchCount++ == 0)
+         firstMismatch = replayFrame;
+      replayFrame++;
+   }
+}
+
+// public static ---------------------------------------------------------------------------------------------
+size_t InputRecorder::getMismatchCount()
+{
+   return mismatchCount;
+}
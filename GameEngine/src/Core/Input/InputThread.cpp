@@ -0,0 +1,186 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InputThread.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of the InputThread class
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/InputThread.h"
+#include "../../../include/SpscRing.h"
+#include "../../../include/TerminalDecoder.h"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Events buffered between two drains, a frame that runs long only fills the ring with drag motion
+static const size_t RING_CAPACITY = 4096;
+
+static const size_t READ_BUFFER_BYTES = 4096;
+
+// Input thread state
+static std::thread          inputThread;
+static std::atomic<bool>    stopRequested(false);
+static int                  stopDescriptor  = -1; // Written by stop to wake the thread out of poll
+static int                  readyDescriptor = -1; // Written by the thread, readable while events wait
+static SpscRing<InputEvent> events(RING_CAPACITY);
+
+// private static --------------------------------------------------------------------------------------------
+static bool publish(const std::vector<InputEvent>& decoded)
+{
+   for (const InputEvent& event : decoded)
+   {
+      // A full ring means the main loop is stalled, hold the event back rather than lose a click
+      while (!events.push(event))
+      {
+         if (stopRequested.load(std::memory_order_acquire))
+            return false;
+         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+   }
+
+   if (!decoded.empty())
+   {
+      uint64_t ready = 1;
+      if (write(readyDescriptor, &ready, sizeof(ready)) != sizeof(ready))
+         return errno == EAGAIN; // Counter saturated, the main loop is already woken
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void readLoop(TerminalDecoder decoder)
+{
+   std::vector<InputEvent> decoded;
+   char                    buffer[READ_BUFFER_BYTES];
+
+   while (!stopRequested.load(std::memory_order_acquire))
+   {
+      int timeout = decoder.hasPartialSequence() ? TerminalDecoder::ESCAPE_TIMEOUT_MILLISECONDS : -1;
+
+      pollfd descriptors[2] = {{STDIN_FILENO, POLLIN, 0}, {stopDescriptor, POLLIN, 0}};
+      int    ready          = poll(descriptors, 2, timeout);
+      if (ready < 0)
+      {
+         if (errno == EINTR) // SIGWINCH lands here as often as on the main thread
+            continue;
+         return;
+      }
+      if (descriptors[1].revents & POLLIN)
+         return;
+
+      auto timestamp = std::chrono::steady_clock::now();
+      decoded.clear();
+      if (ready == 0)
+      {
+         decoder.flush(timestamp, decoded);
+      }
+      else if (descriptors[0].revents & POLLIN)
+      {
+         ssize_t bytesRead = read(STDIN_FILENO, buffer, sizeof(buffer));
+         if (bytesRead < 0 && (errno == EINTR || errno == EAGAIN))
+            continue;
+         if (bytesRead <= 0)
+            return;
+         decoder.decode(buffer, static_cast<size_t>(bytesRead), timestamp, decoded);
+      }
+      else if (descriptors[0].revents & (POLLHUP | POLLERR | POLLNVAL))
+      {
+         return;
+      }
+
+      if (!publish(decoded))
+         return;
+   }
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputThread::start()
+{
+   if (inputThread.joinable())
+      return true;
+
+   stopDescriptor  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+   readyDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+   if (stopDescriptor < 0 || readyDescriptor < 0)
+   {
+      stop();
+      return false;
+   }
+
+   // Drop anything a previous run left behind
+   InputEvent stale;
+   while (events.pop(stale))
+   {
+   }
+
+   stopRequested.store(false, std::memory_order_release);
+   // The decoder looks its key codes up in ncurses, which only the main thread may call
+   inputThread = std::thread(readLoop, TerminalDecoder());
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+void InputThread::stop()
+{
+   if (inputThread.joinable())
+   {
+      // Other than EINTR the write only fails when the counter is already non-zero, poll wakes either way.
+      // Joined before the descriptors the thread polls are closed.
+      stopRequested.store(true, std::memory_order_release);
+      uint64_t wake = 1;
+      while (write(stopDescriptor, &wake, sizeof(wake)) < 0 && errno == EINTR)
+      {
+      }
+      inputThread.join();
+   }
+
+   if (stopDescriptor >= 0)
+      close(stopDescriptor);
+   if (readyDescriptor >= 0)
+      close(readyDescriptor);
+   stopDescriptor  = -1;
+   readyDescriptor = -1;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputThread::isRunning()
+{
+   return inputThread.joinable();
+}
+
+// public static ---------------------------------------------------------------------------------------------
+int InputThread::getWakeDescriptor()
+{
+   return readyDescriptor;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool InputThread::drain(InputQueue& queue)
+{
+   if (!inputThread.joinable())
+      return false;
+
+   // Reset the wake counter before popping, an event pushed meanwhile sets it again
+   uint64_t ready;
+   if (read(readyDescriptor, &ready, sizeof(ready)) != sizeof(ready) && errno != EAGAIN)
+      return false;
+
+   bool       drained = false;
+   InputEvent event;
+   while (events.pop(event))
+   {
+      queue.push(event);
+      drained = true;
+   }
+   return drained;
+}
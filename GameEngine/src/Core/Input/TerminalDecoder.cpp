@@ -0,0 +1,378 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TerminalDecoder.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of the TerminalDecoder class
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/TerminalDecoder.h"
+#include <algorithm>
+
+static const char ESCAPE = '\033';
+
+// Parameters saturate here instead of overflowing, larger than any real key code or mouse coordinate
+static const int MAX_PARAMETER = 99999;
+
+// xterm modifier parameters, Shift is 2 and Shift+Alt+Ctrl 8
+static const int MIN_MODIFIER = 2;
+static const int MAX_MODIFIER = 8;
+
+// CSI final bytes and ~ parameters of the keys a modifier is sent with, see csiKey
+static const char MODIFIED_FINAL_BYTES[] = {'A', 'B', 'C', 'D', 'H', 'F', 'P', 'Q', 'R', 'S'};
+static const int  MAX_TILDE_PARAMETER    = 24;
+
+// xterm button code bits
+static const int MOUSE_BUTTON_BITS = 3;
+static const int MOUSE_SHIFT       = 4;
+static const int MOUSE_META        = 8;
+static const int MOUSE_CONTROL     = 16;
+static const int MOUSE_MOTION      = 32;
+static const int MOUSE_WHEEL       = 64;
+
+// Indexed by the button in the low two bits of a button code, 3 is an x10 release of an unnamed button
+static const mmask_t BUTTON_PRESSES[]  = {BUTTON1_PRESSED, BUTTON2_PRESSED, BUTTON3_PRESSED};
+static const mmask_t BUTTON_RELEASES[] = {BUTTON1_RELEASED, BUTTON2_RELEASED, BUTTON3_RELEASED};
+static const mmask_t WHEEL_PRESSES[]   = {BUTTON4_PRESSED, BUTTON5_PRESSED};
+
+// private static --------------------------------------------------------------------------------------------
+static int csiKey(const char finalByte, const int parameter)
+{
+   switch (finalByte)
+   {
+      case 'A':
+         return KEY_UP;
+      case 'B':
+         return KEY_DOWN;
+      case 'C':
+         return KEY_RIGHT;
+      case 'D':
+         return KEY_LEFT;
+      case 'H':
+         return KEY_HOME;
+      case 'F':
+         return KEY_END;
+      case 'Z':
+         return KEY_BTAB;
+      case 'P':
+      case 'Q':
+      case 'R':
+      case 'S':
+         return KEY_F(finalByte - 'P' + 1); // Only sent this way with a modifier, 1;2P
+      case '~':
+         break;
+      default:
+         return ERR;
+   }
+
+   switch (parameter)
+   {
+      case 1:
+      case 7:
+         return KEY_HOME;
+      case 2:
+         return KEY_IC;
+      case 3:
+         return KEY_DC;
+      case 4:
+      case 8:
+         return KEY_END;
+      case 5:
+         return KEY_PPAGE;
+      case 6:
+         return KEY_NPAGE;
+      case 11:
+      case 12:
+      case 13:
+      case 14:
+      case 15:
+         return KEY_F(parameter - 10);
+      case 17:
+      case 18:
+      case 19:
+      case 20:
+      case 21:
+         return KEY_F(parameter - 11);
+      case 23:
+      case 24:
+         return KEY_F(parameter - 12);
+      default:
+         return ERR;
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static int ss3Key(const char finalByte)
+{
+   switch (finalByte)
+   {
+      case 'A':
+         return KEY_UP;
+      case 'B':
+         return KEY_DOWN;
+      case 'C':
+         return KEY_RIGHT;
+      case 'D':
+         return KEY_LEFT;
+      case 'H':
+         return KEY_HOME;
+      case 'F':
+         return KEY_END;
+      case 'M':
+         return KEY_ENTER;
+      case 'P':
+      case 'Q':
+      case 'R':
+      case 'S':
+         return KEY_F(finalByte - 'P' + 1);
+      default:
+         return ERR;
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static size_t parseParameters(const char* begin, const char* end, int* values, const size_t maxValues)
+{
+   // A leading private marker such as the < of SGR mouse reports is skipped
+   if (begin < end && *begin >= '<' && *begin <= '?')
+      begin++;
+
+   size_t count = 0;
+   bool   digit = false;
+   for (const char* c = begin; c < end && count < maxValues; c++)
+   {
+      if (*c >= '0' && *c <= '9')
+      {
+         values[count] = std::min(MAX_PARAMETER, values[count] * 10 + (*c - '0'));
+         digit         = true;
+      }
+      else if (*c == ';')
+      {
+         count++;
+         digit = false;
+      }
+      else
+      {
+         break;
+      }
+   }
+   return digit && count < maxValues ? count + 1 : count;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+TerminalDecoder::TerminalDecoder()
+{
+   m_pressedButtons = 0;
+
+   // The terminal's terminfo names the modified keys (kri, kUP5, kf25...), ncurses assigns each a key code
+   // when keypad is enabled and getch reports that code for the same bytes. ncurses is not thread safe, so
+   // every sequence csiKey knows is resolved here instead of while decoding.
+   for (int modifier = MIN_MODIFIER; modifier <= MAX_MODIFIER; modifier++)
+   {
+      std::string suffix = ";" + std::to_string(modifier);
+      for (const char finalByte : MODIFIED_FINAL_BYTES)
+      {
+         int code = key_defined(("\033[1" + suffix + finalByte).c_str());
+         if (code > 0)
+            m_modifiedKeys.emplace(std::make_pair(csiKey(finalByte, 1), modifier), code);
+      }
+      for (int parameter = 1; parameter <= MAX_TILDE_PARAMETER; parameter++)
+      {
+         int key = csiKey('~', parameter);
+         if (key == ERR)
+            continue;
+
+         int code = key_defined(("\033[" + std::to_string(parameter) + suffix + "~").c_str());
+         if (code > 0)
+            m_modifiedKeys.emplace(std::make_pair(key, modifier), code);
+      }
+   }
+};
+
+// private ---------------------------------------------------------------------------------------------------
+int TerminalDecoder::modifiedKey(const int key, const int modifier) const
+{
+   auto code = m_modifiedKeys.find(std::make_pair(key, modifier));
+   return code != m_modifiedKeys.end() ? code->second : key;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void TerminalDecoder::addMouseEvent(const int code, const bool released, const int x, const int y,
+                                    const std::chrono::steady_clock::time_point timestamp,
+                                    std::vector<InputEvent>& events)
+{
+   mmask_t buttonState = 0;
+   int     button      = code & MOUSE_BUTTON_BITS;
+
+   if (code & MOUSE_WHEEL)
+   {
+      if (button < 2)
+         buttonState = WHEEL_PRESSES[button];
+   }
+   else if (code & MOUSE_MOTION)
+   {
+      buttonState = REPORT_MOUSE_POSITION;
+   }
+   else if (released || button == MOUSE_BUTTON_BITS)
+   {
+      // An x10 release does not name its button, release every button still down
+      for (int i = 0; i < 3; i++)
+      {
+         if (button == i || (button == MOUSE_BUTTON_BITS && (m_pressedButtons & BUTTON_PRESSES[i])))
+         {
+            buttonState |= BUTTON_RELEASES[i];
+            m_pressedButtons &= ~BUTTON_PRESSES[i];
+         }
+      }
+      if (buttonState == 0)
+         buttonState = REPORT_MOUSE_POSITION;
+   }
+   else
+   {
+      buttonState = BUTTON_PRESSES[button];
+      m_pressedButtons |= buttonState;
+   }
+
+   if (code & MOUSE_SHIFT)
+      buttonState |= BUTTON_SHIFT;
+   if (code & MOUSE_META)
+      buttonState |= BUTTON_ALT;
+   if (code & MOUSE_CONTROL)
+      buttonState |= BUTTON_CTRL;
+
+   events.push_back({KEY_MOUSE, Position(x, y), buttonState, 0, timestamp});
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void TerminalDecoder::decode(const char* bytes, const size_t length,
+                             const std::chrono::steady_clock::time_point timestamp,
+                             std::vector<InputEvent>& events)
+{
+   // Only a sequence cut off by the last read is copied, everything else is decoded straight from bytes
+   const char* input      = bytes;
+   size_t      size       = length;
+   bool        wasPending = !m_pending.empty();
+   if (wasPending)
+   {
+      m_pending.append(bytes, length);
+      input = m_pending.data();
+      size  = m_pending.size();
+   }
+
+   size_t i = 0;
+   while (i < size)
+   {
+      if (input[i] != ESCAPE)
+      {
+         events.push_back({static_cast<unsigned char>(input[i]), Position(), 0, 0, timestamp});
+         i++;
+         continue;
+      }
+
+      if (i + 1 >= size)
+         break;
+
+      // SS3, one final byte
+      if (input[i + 1] == 'O')
+      {
+         if (i + 2 >= size)
+            break;
+
+         int key = ss3Key(input[i + 2]);
+         if (key != ERR)
+            events.push_back({key, Position(), 0, 0, timestamp});
+         i += 3;
+         continue;
+      }
+
+      // Escape followed by anything else is an Alt chord, ncurses also reports the Escape on its own
+      if (input[i + 1] != '[')
+      {
+         events.push_back({ESCAPE, Position(), 0, 0, timestamp});
+         i++;
+         continue;
+      }
+
+      // x10 mouse report, three bytes offset by 32, only used by terminals without SGR mouse mode
+      if (i + 2 < size && input[i + 2] == 'M')
+      {
+         if (i + 5 >= size)
+            break;
+
+         int code = static_cast<unsigned char>(input[i + 3]) - 32;
+         int x    = static_cast<unsigned char>(input[i + 4]) - 33;
+         int y    = static_cast<unsigned char>(input[i + 5]) - 33;
+         addMouseEvent(code, false, x, y, timestamp, events);
+         i += 6;
+         continue;
+      }
+
+      // CSI, parameter and intermediate bytes up to a final byte in 0x40-0x7E
+      size_t end = i + 2;
+      while (end < size && (input[end] < 0x40 || input[end] > 0x7E))
+      {
+         end++;
+      }
+      if (end >= size)
+         break;
+
+      int    parameters[3] = {0, 0, 0};
+      size_t count         = parseParameters(input + i + 2, input + end, parameters, 3);
+      char   finalByte     = input[end];
+
+      // SGR mouse report, ESC [ < code ; column ; row, M on press and motion, m on release
+      if (input[i + 2] == '<' && (finalByte == 'M' || finalByte == 'm'))
+      {
+         if (count == 3)
+            addMouseEvent(parameters[0], finalByte == 'm', parameters[1] - 1, parameters[2] - 1, timestamp,
+                          events);
+         i = end + 1;
+         continue;
+      }
+
+      // Shift, Alt and Ctrl arrive as a second parameter (1;5A), reported unmodified if terminfo has no code
+      int key = csiKey(finalByte, parameters[0]);
+      if (key != ERR && count >= 2 && parameters[1] > 1)
+         key = modifiedKey(key, parameters[1]);
+      if (key != ERR)
+         events.push_back({key, Position(), 0, 0, timestamp});
+      i = end + 1;
+   }
+
+   if (input == m_pending.data())
+      m_pending.erase(0, i);
+   else
+      m_pending.assign(input + i, size - i);
+
+   // The Escape timeout runs from when the unfinished sequence started
+   if (!m_pending.empty() && (!wasPending || i > 0))
+      m_pendingSince = timestamp;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool TerminalDecoder::hasPartialSequence() const
+{
+   return !m_pending.empty();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void TerminalDecoder::flush(const std::chrono::steady_clock::time_point timestamp,
+                            std::vector<InputEvent>& events)
+{
+   for (char byte : m_pending)
+   {
+      events.push_back({static_cast<unsigned char>(byte), Position(), 0, 0, timestamp});
+   }
+   m_pending.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void TerminalDecoder::flushExpired(const std::chrono::steady_clock::time_point now,
+                                   std::vector<InputEvent>& events)
+{
+   if (!m_pending.empty() && now - m_pendingSince >= std::chrono::milliseconds(ESCAPE_TIMEOUT_MILLISECONDS))
+      flush(now, events);
+};
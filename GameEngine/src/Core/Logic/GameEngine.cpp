@@ -11,7 +11,9 @@
 
 #include "../../../include/GameEngine.h"
 #include <ncurses.h>
+#include <poll.h>
 #include <unistd.h>
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -19,6 +21,8 @@
 
 using Clock = std::chrono::steady_clock;
 
+static const size_t READ_BUFFER_BYTES = 4096;
+
 // public ----------------------------------------------------------------------------------------------------
 void GameEngine::run()
 {
@@ -33,30 +37,29 @@ void GameEngine::run()
       float                        deltaTime   = delta.count();
       lastTime                                 = currentTime;
 
+      // --- Replay ---
+      // A replay runs each frame with its recorded deltaTime and stops when the recording ends
+      deltaTime = InputRecorder::beginFrame(deltaTime);
+      if (!engineRunning)
+         break;
+
       // --- Input Handling ---
-      int ch;
-      while ((ch = getch()) != ERR)
+      bool receivedInput = readInput();
+      // --- Finish Background Loads ---
+      PrintableFactory::completePendingLoads();
+
+      // Recording and replaying finish loads on the frame that started them, so a load lands on the same
+      // frame in both no matter how long it takes
+      bool deterministic = InputRecorder::isRecording() || InputRecorder::isReplaying();
+      while (deterministic && PrintableFactory::hasPendingLoads())
       {
-         userInput = ch;
-         if (userInput == '`')
-            engineRunning = false;
-
-         // For mouse events, always process through InputHandler AND state
-         if (userInput == KEY_MOUSE)
-         {
-            globalInputHandler.processInput(userInput);
-            // State will also process mouse events in its update()
-         }
-         else
-         {
-            // For non-mouse events, use exclusive logic
-            if (!globalInputHandler.processInput(userInput))
-            {
-               // If InputHandler didn't handle the input, let the state handle it
-               // This allows states to handle their own specific input logic
-            }
-         }
+         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         PrintableFactory::completePendingLoads();
       }
+
+      // --- Hot Reload ---
+      AnimationWatcher::applyReloads();
+
       // State Update
       currentState->update();
       GameState* next = currentState->getNextState();
@@ -70,15 +73,99 @@ void GameEngine::run()
 
       // --- Refresh display using actual deltaTime ---
       Display::refreshDisplay(deltaTime);
+      InputRecorder::endFrame(inputEvents, deltaTime);
+
+      // --- Idle Sleep ---
+      // With no input this frame, sleep until the next animation frame change (capped) and wake early if
+      // input arrives. Right after input keep the short sleep, more events usually follow close behind, and
+      // while assets load in the background so they are attached as soon as they are parsed.
+      if (InputRecorder::isReplaying())
+         continue; // Frames are paced by the recording, or not at all
+
+      int sleepMilliseconds = 1;
+      if (!receivedInput && !PrintableFactory::hasPendingLoads())
+      {
+         float untilNextChange = Display::getTimeUntilNextChange() * 1000.0f;
+         sleepMilliseconds     = untilNextChange >= maxIdleSleepMilliseconds
+                                       ? maxIdleSleepMilliseconds
+                                       : std::max(1, static_cast<int>(untilNextChange));
+      }
 
-      std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Prevent CPU maxing out
+      if (sleepMilliseconds > 1)
+      {
+         int    descriptor = InputThread::isRunning() ? InputThread::getWakeDescriptor() : STDIN_FILENO;
+         pollfd input      = {descriptor, POLLIN, 0};
+         poll(&input, 1, sleepMilliseconds);
+      }
+      else
+      {
+         std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Prevent CPU maxing out
+      }
    }
 
    exit();
 }
 
+// private ---------------------------------------------------------------------------------------------------
+bool GameEngine::readInput()
+{
+   inputEvents.clear();
+
+   bool receivedInput = false;
+   if (InputRecorder::isReplaying())
+   {
+      // The terminal is ignored, the frame gets exactly the events recorded for it
+      receivedInput = InputRecorder::readFrameInput(inputEvents);
+   }
+   else if (InputThread::isRunning())
+   {
+      // The input thread owns stdin while it runs, its events were already read and decoded
+      receivedInput = InputThread::drain(inputEvents);
+   }
+   else
+   {
+      // Whole buffers are read and decoded in one pass, getch would hand them out one key and one getmouse
+      // round trip at a time and ncurses does not decode SGR mouse reports
+      Clock::time_point timestamp = Clock::now();
+      char              buffer[READ_BUFFER_BYTES];
+      pollfd            input = {STDIN_FILENO, POLLIN, 0};
+      decodedInput.clear();
+      while (poll(&input, 1, 0) > 0 && (input.revents & POLLIN))
+      {
+         ssize_t bytesRead = read(STDIN_FILENO, buffer, sizeof(buffer));
+         if (bytesRead <= 0)
+            break;
+         terminalDecoder.decode(buffer, static_cast<size_t>(bytesRead), timestamp, decodedInput);
+      }
+      terminalDecoder.flushExpired(timestamp, decodedInput);
+
+      for (const InputEvent& event : decodedInput)
+      {
+         inputEvents.push(event);
+      }
+      receivedInput = !decodedInput.empty();
+   }
+
+   for (const InputEvent& event : inputEvents)
+   {
+      userInput = event.key;
+      if (userInput == '`')
+         engineRunning = false;
+   }
+
+   // The InputHandler sees every event of the frame before the state's update does
+   for (const InputEvent& event : inputEvents)
+   {
+      globalInputHandler.processInput(event);
+   }
+   return receivedInput;
+}
+
 // private ---------------------------------------------------------------------------------------------------
 void GameEngine::exit()
 {
+   AnimationWatcher::stop();
+   InputThread::stop();
    Display::closeCurseWindow();
+   InputRecorder::stop();
 }
\ No newline at end of file
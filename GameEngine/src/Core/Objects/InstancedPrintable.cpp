@@ -0,0 +1,259 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file InstancedPrintable.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of InstancedPrintable class for drawing many copies of one animation
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/InstancedPrintable.h"
+#include <iostream>
+
+// public ----------------------------------------------------------------------------------------------------
+InstancedPrintable::InstancedPrintable() : Printable()
+{
+   m_moveableByCamera = true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+InstancedPrintable::InstancedPrintable(const std::string printableName, const Animation animation,
+                                       const bool visable, const bool moveableByCamera)
+{
+   m_printableName    = printableName;
+   m_visable          = visable;
+   m_moveableByCamera = moveableByCamera;
+   setSharedAnimation(animation);
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void InstancedPrintable::setSharedAnimation(const Animation& animation)
+{
+   m_animations.clear();
+   m_currentAnimationName = animation.getAnimationName();
+   if (animation.getStream())
+   {
+      std::cerr << "Warning: InstancedPrintable \"" << m_printableName
+                << "\" cannot share streamed animation \"" << animation.getAnimationName() << "\"" << std::endl;
+      Animation empty;
+      empty.setAnimationName(animation.getAnimationName());
+      m_animations.push_back(empty);
+      return;
+   }
+
+   // Instances draw straight from the frames, which delta frames leave without pixels
+   m_animations.push_back(animation);
+   m_animations.back().decodeDeltas();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t InstancedPrintable::addInstance(const Position position, const size_t startFrame)
+{
+   size_t frameCount = getCurrentAnimation().getTotalFrames();
+
+   m_instanceX.push_back(position.getX());
+   m_instanceY.push_back(position.getY());
+   m_instanceFrame.push_back(frameCount > 0 ? startFrame % frameCount : 0);
+   m_instanceTimer.push_back(0.0f);
+   m_instanceVisible.push_back(1);
+
+   return m_instanceX.size() - 1;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::removeInstance(const size_t index)
+{
+   if (index >= m_instanceX.size())
+      return;
+
+   size_t last = m_instanceX.size() - 1;
+
+   m_instanceX[index]       = m_instanceX[last];
+   m_instanceY[index]       = m_instanceY[last];
+   m_instanceFrame[index]   = m_instanceFrame[last];
+   m_instanceTimer[index]   = m_instanceTimer[last];
+   m_instanceVisible[index] = m_instanceVisible[last];
+
+   m_instanceX.pop_back();
+   m_instanceY.pop_back();
+   m_instanceFrame.pop_back();
+   m_instanceTimer.pop_back();
+   m_instanceVisible.pop_back();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::clearInstances()
+{
+   m_instanceX.clear();
+   m_instanceY.clear();
+   m_instanceFrame.clear();
+   m_instanceTimer.clear();
+   m_instanceVisible.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t InstancedPrintable::getInstanceCount() const
+{
+   return m_instanceX.size();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::setInstancePosition(const size_t index, const Position position)
+{
+   if (index >= m_instanceX.size())
+      return;
+
+   m_instanceX[index] = position.getX();
+   m_instanceY[index] = position.getY();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+Position InstancedPrintable::getInstancePosition(const size_t index) const
+{
+   if (index >= m_instanceX.size())
+      return Position(0, 0);
+
+   return Position(m_instanceX[index], m_instanceY[index]);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::displaceInstance(const size_t index, const int dx, const int dy)
+{
+   if (index >= m_instanceX.size())
+      return;
+
+   m_instanceX[index] += dx;
+   m_instanceY[index] += dy;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::setInstanceFrame(const size_t index, const size_t frameIndex)
+{
+   if (index >= m_instanceX.size())
+      return;
+
+   size_t frameCount = getCurrentAnimation().getTotalFrames();
+
+   m_instanceFrame[index] = frameCount > 0 ? frameIndex % frameCount : 0;
+   m_instanceTimer[index] = 0.0f;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t InstancedPrintable::getInstanceFrame(const size_t index) const
+{
+   if (index >= m_instanceFrame.size())
+      return 0;
+
+   return m_instanceFrame[index];
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::setInstanceVisability(const size_t index, const bool visable)
+{
+   if (index >= m_instanceX.size())
+      return;
+
+   m_instanceVisible[index] = visable ? 1 : 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InstancedPrintable::isInstanceVisable(const size_t index) const
+{
+   if (index >= m_instanceVisible.size())
+      return false;
+
+   return m_instanceVisible[index] != 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::displace(const int dx, const int dy)
+{
+   for (size_t i = 0; i < m_instanceX.size(); i++)
+   {
+      m_instanceX[i] += dx;
+      m_instanceY[i] += dy;
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InstancedPrintable::drawToWindow(NcursesWindow& window, const float deltaTime)
+{
+   const Animation&          animation = getCurrentAnimation();
+   const std::vector<Frame>& frames    = animation.getFrames();
+
+   if (animation.isPlaying())
+   {
+      updateInstances(deltaTime);
+   }
+
+   // Draw pass: every visible instance from the shared frames
+   for (size_t i = 0; i < m_instanceX.size(); i++)
+   {
+      if (!m_instanceVisible[i] || m_instanceFrame[i] >= frames.size())
+         continue;
+
+      window.printSpriteAtOffset(frames[m_instanceFrame[i]].getSprite(), m_instanceX[i], m_instanceY[i],
+                                 m_moveableByCamera);
+
+      m_drawnX.push_back(m_instanceX[i]);
+      m_drawnY.push_back(m_instanceY[i]);
+      m_drawnFrame.push_back(m_instanceFrame[i]);
+   }
+
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void InstancedPrintable::eraseBatched(NcursesWindow& window)
+{
+   const std::vector<Frame>& frames = getCurrentAnimation().getFrames();
+   for (size_t i = 0; i < m_drawnX.size(); i++)
+   {
+      if (m_drawnFrame[i] < frames.size())
+      {
+         window.eraseSpriteAtOffset(frames[m_drawnFrame[i]].getSprite(), m_drawnX[i], m_drawnY[i],
+                                    m_moveableByCamera);
+      }
+   }
+
+   m_drawnX.clear();
+   m_drawnY.clear();
+   m_drawnFrame.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool InstancedPrintable::isBatched() const
+{
+   return true;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void InstancedPrintable::updateInstances(const float deltaTime)
+{
+   const Animation&          animation = getCurrentAnimation();
+   const std::vector<Frame>& frames    = animation.getFrames();
+   const bool                repeats   = animation.getRepeats();
+
+   if (frames.empty())
+      return;
+
+   const size_t lastFrame = frames.size() - 1;
+
+   for (size_t i = 0; i < m_instanceTimer.size(); i++)
+   {
+      m_instanceTimer[i] += deltaTime;
+
+      size_t frame = m_instanceFrame[i];
+      while (m_instanceTimer[i] >= frames[frame].getDuration())
+      {
+         if ((frame == lastFrame && !repeats) || frames[frame].getDuration() <= 0.0f)
+            break; // Stop at last frame
+
+         m_instanceTimer[i] -= frames[frame].getDuration();
+         frame = (frame == lastFrame) ? 0 : frame + 1;
+      }
+      m_instanceFrame[i] = frame;
+   }
+};
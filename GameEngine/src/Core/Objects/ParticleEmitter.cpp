@@ -0,0 +1,326 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ParticleEmitter.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of ParticleEmitter class for batched single cell particle effects
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/ParticleEmitter.h"
+#include "../../../include/Parameters.h"
+#include <algorithm>
+#include <cmath>
+
+// Emitters created so far, offsets a fixed randomSeed so emitters do not all share one sequence
+static unsigned int emittersCreated = 0;
+
+// public ----------------------------------------------------------------------------------------------------
+ParticleEmitter::ParticleEmitter() : ParticleEmitter("particles", Position(0, 0), 256, true, true) {};
+
+// public ----------------------------------------------------------------------------------------------------
+ParticleEmitter::ParticleEmitter(const std::string printableName, const Position origin,
+                                 const size_t maxParticles, const bool visable, const bool moveableByCamera)
+{
+   m_printableName       = printableName;
+   m_visable             = visable;
+   m_moveableByCamera    = moveableByCamera;
+   m_maxParticles        = maxParticles;
+   m_origin              = origin;
+   m_spawnWidth          = 1;
+   m_spawnHeight         = 1;
+   m_emissionRate        = 0.0f;
+   m_emissionAccumulator = 0.0f;
+   m_minVelocityX        = -1.0f;
+   m_maxVelocityX        = 1.0f;
+   m_minVelocityY        = -1.0f;
+   m_maxVelocityY        = 1.0f;
+   m_gravityX            = 0.0f;
+   m_gravityY            = 0.0f;
+   m_minLifetime         = 1.0f;
+   m_maxLifetime         = 1.0f;
+   m_glyphs              = L"*";
+   m_colors              = {RGB(1000, 1000, 1000)};
+   m_colorByAge          = false;
+
+   m_random = std::mt19937(randomSeed != 0 ? randomSeed + emittersCreated++ : std::random_device{}());
+
+   m_x.reserve(maxParticles);
+   m_y.reserve(maxParticles);
+   m_velocityX.reserve(maxParticles);
+   m_velocityY.reserve(maxParticles);
+   m_life.reserve(maxParticles);
+   m_maxLife.reserve(maxParticles);
+   m_glyph.reserve(maxParticles);
+   m_color.reserve(maxParticles);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::update(const float deltaTime)
+{
+   // Continuous emission, fractional particles carry over to the next refresh
+   if (m_emissionRate > 0.0f)
+   {
+      m_emissionAccumulator += m_emissionRate * deltaTime;
+      while (m_emissionAccumulator >= 1.0f)
+      {
+         m_emissionAccumulator -= 1.0f;
+         spawnParticle();
+      }
+   }
+
+   const size_t count = m_x.size();
+   float*       x     = m_x.data();
+   float*       y     = m_y.data();
+   float*       vx    = m_velocityX.data();
+   float*       vy    = m_velocityY.data();
+   float*       life  = m_life.data();
+
+   // Straight loops over the arrays so the compiler can vectorize them
+   const float gravityX = m_gravityX * deltaTime;
+   const float gravityY = m_gravityY * deltaTime;
+   for (size_t i = 0; i < count; i++)
+   {
+      vx[i] += gravityX;
+      vy[i] += gravityY;
+   }
+   for (size_t i = 0; i < count; i++)
+   {
+      x[i] += vx[i] * deltaTime;
+      y[i] += vy[i] * deltaTime;
+   }
+   for (size_t i = 0; i < count; i++)
+   {
+      life[i] -= deltaTime;
+   }
+
+   // Remove expired particles, walking backwards so swapped in particles are already checked
+   for (size_t i = count; i-- > 0;)
+   {
+      if (m_life[i] <= 0.0f)
+      {
+         removeParticle(i);
+      }
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::burst(const size_t count)
+{
+   for (size_t i = 0; i < count; i++)
+   {
+      spawnParticle();
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::clearParticles()
+{
+   m_x.clear();
+   m_y.clear();
+   m_velocityX.clear();
+   m_velocityY.clear();
+   m_life.clear();
+   m_maxLife.clear();
+   m_glyph.clear();
+   m_color.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t ParticleEmitter::getParticleCount() const
+{
+   return m_x.size();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setMaxParticles(const size_t maxParticles)
+{
+   m_maxParticles = maxParticles;
+   while (m_x.size() > m_maxParticles)
+   {
+      removeParticle(m_x.size() - 1);
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setOrigin(const Position origin)
+{
+   m_origin = origin;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const Position& ParticleEmitter::getOrigin() const
+{
+   return m_origin;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setSpawnArea(const int width, const int height)
+{
+   m_spawnWidth  = std::max(1, width);
+   m_spawnHeight = std::max(1, height);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setEmissionRate(const float particlesPerSecond)
+{
+   m_emissionRate = std::max(0.0f, particlesPerSecond);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setVelocityRange(const float minX, const float maxX, const float minY, const float maxY)
+{
+   m_minVelocityX = std::min(minX, maxX);
+   m_maxVelocityX = std::max(minX, maxX);
+   m_minVelocityY = std::min(minY, maxY);
+   m_maxVelocityY = std::max(minY, maxY);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setGravity(const float gravityX, const float gravityY)
+{
+   m_gravityX = gravityX;
+   m_gravityY = gravityY;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setLifetimeRange(const float minSeconds, const float maxSeconds)
+{
+   m_minLifetime = std::max(0.0f, std::min(minSeconds, maxSeconds));
+   m_maxLifetime = std::max(0.0f, std::max(minSeconds, maxSeconds));
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setGlyphs(const std::wstring glyphs)
+{
+   m_glyphs = glyphs.empty() ? L"*" : glyphs;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::setColors(const std::vector<RGB> colors, const bool colorByAge)
+{
+   m_colors = colors;
+   if (m_colors.empty())
+   {
+      m_colors.push_back(RGB(1000, 1000, 1000));
+   }
+   if (m_colors.size() > 256)
+   {
+      m_colors.resize(256);
+   }
+   m_colorByAge = colorByAge;
+
+   // Live particles keep their color when it is still in the table, the last color otherwise
+   const uint8_t lastColor = static_cast<uint8_t>(m_colors.size() - 1);
+   for (uint8_t& color : m_color)
+   {
+      color = std::min(color, lastColor);
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::displace(const int dx, const int dy)
+{
+   m_origin = Position(m_origin.getX() + dx, m_origin.getY() + dy);
+   for (size_t i = 0; i < m_x.size(); i++)
+   {
+      m_x[i] += dx;
+      m_y[i] += dy;
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool ParticleEmitter::drawToWindow(NcursesWindow& window, const float deltaTime)
+{
+   update(deltaTime);
+
+   const size_t colorCount = m_colors.size();
+   for (size_t i = 0; i < m_x.size(); i++)
+   {
+      int cellX = static_cast<int>(std::floor(m_x[i]));
+      int cellY = static_cast<int>(std::floor(m_y[i]));
+
+      size_t color = m_color[i];
+      if (m_colorByAge && m_maxLife[i] > 0.0f)
+      {
+         float age = 1.0f - (m_life[i] / m_maxLife[i]);
+         color     = std::min(colorCount - 1, static_cast<size_t>(age * colorCount));
+      }
+
+      window.printCell(cellX, cellY, m_glyph[i], m_colors[color], m_moveableByCamera);
+      m_drawnX.push_back(cellX);
+      m_drawnY.push_back(cellY);
+   }
+
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ParticleEmitter::eraseBatched(NcursesWindow& window)
+{
+   for (size_t i = 0; i < m_drawnX.size(); i++)
+   {
+      window.eraseCell(m_drawnX[i], m_drawnY[i], m_moveableByCamera);
+   }
+   m_drawnX.clear();
+   m_drawnY.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool ParticleEmitter::isBatched() const
+{
+   return true;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void ParticleEmitter::spawnParticle()
+{
+   if (m_x.size() >= m_maxParticles)
+      return;
+
+   float lifetime = randomRange(m_minLifetime, m_maxLifetime);
+
+   m_x.push_back(m_origin.getX() + randomRange(0.0f, static_cast<float>(m_spawnWidth)));
+   m_y.push_back(m_origin.getY() + randomRange(0.0f, static_cast<float>(m_spawnHeight)));
+   m_velocityX.push_back(randomRange(m_minVelocityX, m_maxVelocityX));
+   m_velocityY.push_back(randomRange(m_minVelocityY, m_maxVelocityY));
+   m_life.push_back(lifetime);
+   m_maxLife.push_back(lifetime);
+   m_glyph.push_back(m_glyphs[m_random() % m_glyphs.size()]);
+   m_color.push_back(m_colorByAge ? 0 : static_cast<uint8_t>(m_random() % m_colors.size()));
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void ParticleEmitter::removeParticle(const size_t index)
+{
+   size_t last = m_x.size() - 1;
+
+   m_x[index]         = m_x[last];
+   m_y[index]         = m_y[last];
+   m_velocityX[index] = m_velocityX[last];
+   m_velocityY[index] = m_velocityY[last];
+   m_life[index]      = m_life[last];
+   m_maxLife[index]   = m_maxLife[last];
+   m_glyph[index]     = m_glyph[last];
+   m_color[index]     = m_color[last];
+
+   m_x.pop_back();
+   m_y.pop_back();
+   m_velocityX.pop_back();
+   m_velocityY.pop_back();
+   m_life.pop_back();
+   m_maxLife.pop_back();
+   m_glyph.pop_back();
+   m_color.pop_back();
+};
+
+// private ---------------------------------------------------------------------------------------------------
+float ParticleEmitter::randomRange(const float min, const float max)
+{
+   if (max <= min)
+      return min;
+
+   return std::uniform_real_distribution<float>(min, max)(m_random);
+};
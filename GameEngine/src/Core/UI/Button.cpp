@@ -10,7 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../../../include/Button.h"
-#include <climits>
+#include <algorithm>
 
 Button::~Button() = default;
 
@@ -27,7 +27,7 @@ Button::Button()
    m_minPosition      = Position(0, 0);
    m_maxPosition      = Position(0, 0);
    m_ncurseWindow     = nullptr;
-   m_isHighlighted    = false;
+   m_hasLabel         = false;
 
    // Initialize automatic highlighting with default colors
    m_autoHighlightEnabled = true;
@@ -50,17 +50,14 @@ Button::Button(const std::string printableName, const std::vector<Animation> ani
    m_maxPosition          = Position(0, 0);
    setFunction(function);
    setPositions();
-   m_ncurseWindow  = nullptr;
-   m_isHighlighted = false;
+   m_ncurseWindow = nullptr;
+   m_hasLabel     = false;
 
    // Initialize automatic highlighting with default colors
    m_autoHighlightEnabled = true;
    m_hoverColor           = RGB(750, 750, 750); // Light gray
    m_clickColor           = RGB(500, 500, 500); // Darker gray
    m_selectedColor        = RGB(250, 250, 250); // Brightest
-
-   // Store original background colors
-   storeOriginalColors();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -76,17 +73,14 @@ Button::Button(const std::string printableName, const std::vector<Animation> ani
    m_minPosition          = Position(0, 0);
    m_maxPosition          = Position(0, 0);
    setPositions();
-   m_ncurseWindow  = nullptr;
-   m_isHighlighted = false;
+   m_ncurseWindow = nullptr;
+   m_hasLabel     = false;
 
    // Disable automatic highlighting for buttons without functions
    m_autoHighlightEnabled = false;
    m_hoverColor           = RGB(750, 750, 750); // Light gray
    m_clickColor           = RGB(500, 500, 500); // Darker gray
    m_selectedColor        = RGB(250, 250, 250); // Brightest
-
-   // Store original background colors
-   storeOriginalColors();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -133,222 +127,91 @@ bool Button::mouseInBounds(Position position)
 }
 
 // public ----------------------------------------------------------------------------------------------------
-void Button::setText(std::string text)
+bool Button::setText(const std::string& text)
 {
-   Animation& animation = getCurrentAnimationMutable();
-   Sprite&    sprite    = animation.getCurrentFrameSpriteMutable();
-
-   wchar_t topLeftCorner = L'+', topRightCorner = L'+', bottomLeftCorner = L'+', bottomRightCorner = L'+';
-   wchar_t topEdge = L'-', bottomEdge = L'-', leftEdge = L'|', rightEdge = L'|';
-
-   const std::vector<Pixel>& currentPixels = sprite.getPixels();
-   int                       minX = INT_MAX, maxX = INT_MIN, minY = INT_MAX, maxY = INT_MIN;
-
-   if (!currentPixels.empty())
-   {
-      for (const Pixel& pixel : currentPixels)
-      {
-         int x = pixel.getPosition().getX();
-         int y = pixel.getPosition().getY();
-         if (x < minX)
-            minX = x;
-         if (x > maxX)
-            maxX = x;
-         if (y < minY)
-            minY = y;
-         if (y > maxY)
-            maxY = y;
-      }
-
-      for (const Pixel& pixel : currentPixels)
-      {
-         int     x = pixel.getPosition().getX();
-         int     y = pixel.getPosition().getY();
-         wchar_t c = pixel.getCharacter();
-
-         if (y == minY)
-         {
-            if (x == minX)
-               topLeftCorner = c;
-            else if (x == maxX)
-               topRightCorner = c;
-            else
-               topEdge = c;
-         }
-         else if (y == maxY)
-         {
-            if (x == minX)
-               bottomLeftCorner = c;
-            else if (x == maxX)
-               bottomRightCorner = c;
-            else
-               bottomEdge = c;
-         }
-         else
-         {
-            if (x == minX)
-               leftEdge = c;
-            else if (x == maxX)
-               rightEdge = c;
-         }
-      }
-   }
-
-   std::vector<std::string> lines;
-   std::string              currentLine;
-   for (char c : text)
-   {
-      if (c == '\n')
-      {
-         lines.push_back(currentLine);
-         currentLine.clear();
-      }
-      else
-      {
-         currentLine += c;
-      }
-   }
-   lines.push_back(currentLine);
-
-   size_t maxLineLength = 0;
-   for (const std::string& line : lines)
-   {
-      if (line.length() > maxLineLength)
-      {
-         maxLineLength = line.length();
-      }
-   }
-
-   // First, create the content without borders and store it
-   std::vector<Pixel> contentPixels;
-   for (size_t y = 0; y < lines.size(); y++)
-   {
-      std::string line = lines[y];
-      for (size_t x = 0; x < line.length(); x++)
-      {
-         contentPixels.push_back(
-               Pixel(Position(static_cast<int>(x), static_cast<int>(y)), static_cast<wchar_t>(line[x])));
-      }
-   }
+   // The first text replaces the button's art, whose outline gives the border glyphs
+   if (!m_hasLabel)
+      m_label.setBorderGlyphs(getCurrentAnimation().getCurrentFrameSprite().getPixels());
 
-   // Always store the pure text content (this is the definitive content without borders)
-   m_originalPixels = contentPixels;
-
-   size_t borderLength = std::max(maxLineLength + 4, size_t(6));
+   return applyLabel(m_label.measure(text));
+}
 
-   std::vector<Pixel> newPixels;
+// public ----------------------------------------------------------------------------------------------------
+const std::string& Button::getText() const
+{
+   return m_label.getText();
+}
 
-   std::wstring topBorder = std::wstring(1, topLeftCorner) + std::wstring(borderLength - 2, topEdge) +
-                            std::wstring(1, topRightCorner);
-   for (size_t x = 0; x < topBorder.length(); x++)
+// public ----------------------------------------------------------------------------------------------------
+void Button::setBorder(bool enabled)
+{
+   // Buttons never given a text keep the generic border around their art
+   if (!m_hasLabel)
    {
-      newPixels.push_back(Pixel(Position(static_cast<int>(x), 0), topBorder[x]));
+      UIElement::setBorder(enabled);
+      return;
    }
 
-   for (size_t y = 0; y < lines.size(); y++)
-   {
-      std::string line = lines[y];
-
-      size_t textLength     = line.length();
-      size_t availableSpace = borderLength - 2;
-      size_t padding        = (availableSpace > textLength) ? (availableSpace - textLength) : 0;
-
-      std::wstring paddedLine = std::wstring(1, leftEdge);
-
-      for (char c : line)
-      {
-         paddedLine += static_cast<wchar_t>(c);
-      }
+   m_borderEnabled  = enabled;
+   m_borderAutoSize = true;
+   applyLabel(m_label.measureBordered(enabled));
+}
 
-      paddedLine += std::wstring(padding, L' ');
-      paddedLine += std::wstring(1, rightEdge);
+// private ---------------------------------------------------------------------------------------------------
+bool Button::applyLabel(const LabelChange change)
+{
+   if (change == LabelChange::NONE)
+      return false;
 
-      for (size_t x = 0; x < paddedLine.length(); x++)
-      {
-         newPixels.push_back(Pixel(Position(static_cast<int>(x), static_cast<int>(y + 1)), paddedLine[x]));
-      }
-   }
+   Sprite& sprite = getCurrentAnimationMutable().getCurrentFrameSpriteMutable();
 
-   std::wstring bottomBorder = std::wstring(1, bottomLeftCorner) +
-                               std::wstring(borderLength - 2, bottomEdge) + std::wstring(1, bottomRightCorner);
-   for (size_t x = 0; x < bottomBorder.length(); x++)
-   {
-      newPixels.push_back(
-            Pixel(Position(static_cast<int>(x), static_cast<int>(lines.size() + 1)), bottomBorder[x]));
-   }
+   // Cells the new layout no longer covers are erased, the art before the first text never was drawn here
+   if (change != LabelChange::GLYPHS && m_hasLabel)
+      addDirtySprite(sprite);
+   m_hasLabel = true;
 
-   sprite.setPixels(newPixels);
-   sprite.setAnchor(Position(0, 0));
+   if (m_label.apply(sprite) == LabelChange::GLYPHS)
+      return false;
 
-   // Store original colors after text change
-   storeOriginalColors();
+   // Rebuilt cells come with default colors
+   m_pinnedCells.clear();
 
    setPositions();
+   return change == LabelChange::SIZE;
 }
 
 // public ----------------------------------------------------------------------------------------------------
-void Button::highlight(RGB rgbValue)
+void Button::setTextColors(const size_t column, const size_t row, const RGB& textColor,
+                           const RGB& backgroundColor)
 {
-   if (m_isHighlighted)
-   {
-      unhighlight();
-   }
-
-   Animation&          animation = getCurrentAnimationMutable();
-   Sprite&             sprite    = animation.getCurrentFrameSpriteMutable();
-   std::vector<Pixel>& pixels    = sprite.getPixelsMutable();
-
-   // Store original colors and positions if not already stored
-   if (m_originalBackgroundColors.empty())
-   {
-      storeOriginalColors();
-   }
+   Sprite&             sprite = getCurrentAnimationMutable().getCurrentFrameSpriteMutable();
+   std::vector<Pixel>& pixels = sprite.getPixelsMutable();
+   size_t              index;
+   if (!m_label.getCellIndex(column, row, index) || index >= pixels.size())
+      return;
 
-   // Change all pixels' background colors to the specified RGB value
-   for (Pixel& pixel : pixels)
-   {
-      pixel.setBackgroundColor(rgbValue);
-   }
+   pixels[index].setTextColor(textColor);
+   pixels[index].setBackgroundColor(backgroundColor);
+   if (std::find(m_pinnedCells.begin(), m_pinnedCells.end(), index) == m_pinnedCells.end())
+      m_pinnedCells.push_back(index);
+}
 
-   m_isHighlighted = true;
+// public ----------------------------------------------------------------------------------------------------
+void Button::highlight(RGB rgbValue)
+{
+   setBackgroundOverride(rgbValue);
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void Button::unhighlight()
 {
-   if (!m_isHighlighted || m_originalBackgroundColors.empty())
-   {
-      return;
-   }
-
-   Animation&          animation = getCurrentAnimationMutable();
-   Sprite&             sprite    = animation.getCurrentFrameSpriteMutable();
-   std::vector<Pixel>& pixels    = sprite.getPixelsMutable();
-
-   // Restore original background colors
-   for (size_t i = 0; i < pixels.size() && i < m_originalBackgroundColors.size(); i++)
-   {
-      pixels[i].setBackgroundColor(m_originalBackgroundColors[i]);
-   }
-
-   m_isHighlighted = false;
+   clearBackgroundOverride();
 }
 
-// private ---------------------------------------------------------------------------------------------------
-void Button::storeOriginalColors()
+// public ----------------------------------------------------------------------------------------------------
+bool Button::keepsOwnBackground(const size_t pixelIndex) const
 {
-   const Animation&          animation = getCurrentAnimation();
-   const Sprite&             sprite    = animation.getCurrentFrameSprite();
-   const std::vector<Pixel>& pixels    = sprite.getPixels();
-
-   m_originalBackgroundColors.clear();
-   m_originalPositions.clear();
-
-   for (const Pixel& pixel : pixels)
-   {
-      m_originalBackgroundColors.push_back(pixel.getBackgroundColor());
-      m_originalPositions.push_back(pixel.getPosition());
-   }
+   return std::find(m_pinnedCells.begin(), m_pinnedCells.end(), pixelIndex) != m_pinnedCells.end();
 }
 
 // public ----------------------------------------------------------------------------------------------------
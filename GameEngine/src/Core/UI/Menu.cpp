@@ -11,6 +11,7 @@
 
 #include "../../../include/Menu.h"
 #include "../../../include/Frame.h"
+#include "../../../include/Parameters.h"
 #include "../../../include/RGB.h"
 #include "../../../include/Sprite.h"
 #include <ncurses.h>
@@ -296,4 +297,6 @@ void Menu::generateMenuSprite()
    m_animations.clear();
    m_animations.push_back(menuAnimation);
    m_currentAnimationName = "menu";
+   uiLayoutVersion++;
+   animationTrackingVersion++;
 }
\ No newline at end of file
@@ -12,13 +12,15 @@
 #include "../../../include/Slider.h"
 #include "../../../include/Animation.h"
 #include "../../../include/Frame.h"
+#include "../../../include/Parameters.h"
 #include "../../../include/Pixel.h"
 #include "../../../include/Sprite.h"
 #include <algorithm>
 
 // public ----------------------------------------------------------------------------------------------------
 Slider::Slider(int length, bool horizontal)
-   : UIElement(), m_length(std::max(2, length)), m_position(0), m_horizontal(horizontal)
+   : UIElement(), m_length(std::max(2, length)), m_position(0), m_horizontal(horizontal),
+     m_customAnimation(false)
 {
    m_printableName    = "defaultSlider";
    m_lockPosition     = ScreenLockPosition::NONE;
@@ -26,15 +28,30 @@ Slider::Slider(int length, bool horizontal)
    m_visable          = true;
    m_moveableByCamera = false;
    m_ncurseWindow     = nullptr;
-   updateSprite();
+
+   // The one animation the slider draws into from now on
+   m_animations.clear();
+   m_animations.push_back(Animation("default", {Frame(Sprite(), 1.0f)}, true));
+   m_currentAnimationName = "default";
+   layoutCells();
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void Slider::setLength(int length)
 {
-   m_length   = std::max(2, length);
+   int newLength = std::max(2, length);
+   if (newLength == m_length)
+      return;
+
+   // Cells past a shorter end are erased
+   if (!m_customAnimation && newLength < m_length)
+      addDirtySprite(getCurrentAnimation().getCurrentFrameSprite());
+
+   m_length   = newLength;
    m_position = std::clamp(m_position, 0, m_length - 1);
-   updateSprite();
+   if (!m_customAnimation)
+      layoutCells();
+   setPositions();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -46,8 +63,30 @@ int Slider::getLength() const
 // public ----------------------------------------------------------------------------------------------------
 void Slider::setPosition(int pos)
 {
-   m_position = std::clamp(pos, 0, m_length - 1);
-   updateSprite();
+   int position = std::clamp(pos, 0, m_length - 1);
+   if (position == m_position)
+      return;
+
+   if (m_customAnimation)
+   {
+      m_position = position;
+      return;
+   }
+
+   // Something replaced the cells, a border for one
+   Sprite&             sprite = getCurrentAnimationMutable().getCurrentFrameSpriteMutable();
+   std::vector<Pixel>& pixels = sprite.getPixelsMutable();
+   if (pixels.size() != static_cast<size_t>(m_length))
+   {
+      m_position = position;
+      layoutCells();
+      return;
+   }
+
+   // Only the old and new handle cells change glyph
+   pixels[m_position].setCharacter(L'-');
+   m_position = position;
+   pixels[m_position].setCharacter(L'|');
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -82,6 +121,9 @@ void Slider::setAnimation(const Animation& animation)
    m_animations.clear();
    m_animations.push_back(animation);
    m_currentAnimationName = animation.getAnimationName();
+   m_customAnimation      = true;
+   animationTrackingVersion++;
+   setPositions();
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -132,33 +174,18 @@ void Slider::setPositionFromMouse(Position mousePosition)
 }
 
 // private ---------------------------------------------------------------------------------------------------
-void Slider::updateSprite()
+void Slider::layoutCells()
 {
-   Position prevAnchor =
-         m_animations.empty() ? Position(0, 0) : m_animations.front().getCurrentFrameSprite().getAnchor();
+   Sprite&             sprite = getCurrentAnimationMutable().getCurrentFrameSpriteMutable();
+   Position            anchor = sprite.getAnchor();
+   std::vector<Pixel>& pixels = sprite.getPixelsMutable();
 
-   std::vector<Pixel> pixels;
-   if (m_horizontal)
+   pixels.resize(static_cast<size_t>(m_length));
+   for (int i = 0; i < m_length; ++i)
    {
-      for (int i = 0; i < m_length; ++i)
-      {
-         char ch = (i == m_position) ? '|' : '-';
-         pixels.push_back(Pixel(Position(i, 0), ch));
-      }
+      int     x  = m_horizontal ? i : 0;
+      int     y  = m_horizontal ? 0 : i;
+      wchar_t ch = (i == m_position) ? L'|' : L'-';
+      pixels[i]  = Pixel(Position(anchor.getX() + x, anchor.getY() + y), ch);
    }
-   else
-   {
-      for (int i = 0; i < m_length; ++i)
-      {
-         char ch = (i == m_position) ? '|' : '-';
-         pixels.push_back(Pixel(Position(0, i), ch));
-      }
-   }
-   Sprite sprite(pixels);
-   sprite.moveAnchorToPosition(prevAnchor);
-
-   Animation anim("default", {Frame(sprite, 1.0f)}, true);
-   m_animations.clear();
-   m_animations.push_back(anim);
-   m_currentAnimationName = "default";
 }
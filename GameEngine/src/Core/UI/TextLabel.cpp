@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TextLabel.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of the TextLabel class
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/TextLabel.h"
+#include <algorithm>
+#include <climits>
+
+// Smallest bordered label, wide enough for the corners and a little padding
+static const int MIN_BORDERED_WIDTH = 6;
+
+// public ----------------------------------------------------------------------------------------------------
+TextLabel::TextLabel()
+   : m_width(0), m_height(0), m_bordered(true), m_drawn(false), m_pendingWidth(0), m_pendingHeight(0),
+     m_pendingChange(LabelChange::SIZE), m_topLeft(L'+'), m_topRight(L'+'), m_bottomLeft(L'+'),
+     m_bottomRight(L'+'), m_topEdge(L'-'), m_bottomEdge(L'-'), m_leftEdge(L'|'), m_rightEdge(L'|')
+{
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void TextLabel::setBorderGlyphs(const std::vector<Pixel>& pixels)
+{
+   int minX = INT_MAX, maxX = INT_MIN, minY = INT_MAX, maxY = INT_MIN;
+   for (const Pixel& pixel : pixels)
+   {
+      minX = std::min(minX, pixel.getPosition().getX());
+      maxX = std::max(maxX, pixel.getPosition().getX());
+      minY = std::min(minY, pixel.getPosition().getY());
+      maxY = std::max(maxY, pixel.getPosition().getY());
+   }
+
+   for (const Pixel& pixel : pixels)
+   {
+      int     x = pixel.getPosition().getX();
+      int     y = pixel.getPosition().getY();
+      wchar_t c = pixel.getCharacter();
+
+      if (y == minY)
+      {
+         if (x == minX)
+            m_topLeft = c;
+         else if (x == maxX)
+            m_topRight = c;
+         else
+            m_topEdge = c;
+      }
+      else if (y == maxY)
+      {
+         if (x == minX)
+            m_bottomLeft = c;
+         else if (x == maxX)
+            m_bottomRight = c;
+         else
+            m_bottomEdge = c;
+      }
+      else
+      {
+         if (x == minX)
+            m_leftEdge = c;
+         else if (x == maxX)
+            m_rightEdge = c;
+      }
+   }
+}
+
+// private ---------------------------------------------------------------------------------------------------
+LabelChange TextLabel::measurePending()
+{
+   m_pendingLineLengths.clear();
+   size_t lineLength = 0;
+   size_t longest    = 0;
+   for (char c : m_pendingText)
+   {
+      if (c == '\n')
+      {
+         m_pendingLineLengths.push_back(lineLength);
+         longest    = std::max(longest, lineLength);
+         lineLength = 0;
+      }
+      else
+      {
+         lineLength++;
+      }
+   }
+   m_pendingLineLengths.push_back(lineLength);
+   longest = std::max(longest, lineLength);
+
+   int lines = static_cast<int>(m_pendingLineLengths.size());
+   if (m_bordered)
+   {
+      m_pendingWidth  = std::max(static_cast<int>(longest) + 4, MIN_BORDERED_WIDTH);
+      m_pendingHeight = lines + 2;
+   }
+   else
+   {
+      m_pendingWidth  = static_cast<int>(longest);
+      m_pendingHeight = lines;
+   }
+
+   if (!m_drawn || m_pendingWidth != m_width || m_pendingHeight != m_height)
+      m_pendingChange = LabelChange::SIZE;
+   else if (m_pendingText == m_text)
+      m_pendingChange = LabelChange::NONE;
+   else if (m_bordered || m_pendingLineLengths == m_lineLengths) // Border padding gives every row all cells
+      m_pendingChange = LabelChange::GLYPHS;
+   else
+      m_pendingChange = LabelChange::CELLS;
+   return m_pendingChange;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+LabelChange TextLabel::measure(const std::string& text)
+{
+   m_pendingText = text;
+   return measurePending();
+}
+
+// public ----------------------------------------------------------------------------------------------------
+LabelChange TextLabel::measureBordered(const bool bordered)
+{
+   if (bordered != m_bordered)
+      m_drawn = false; // Every cell moves
+   m_bordered    = bordered;
+   m_pendingText = m_text;
+   return measurePending();
+}
+
+// private ---------------------------------------------------------------------------------------------------
+wchar_t TextLabel::getGlyph(const int column, const int row, const size_t lineStart,
+                            const size_t lineLength) const
+{
+   if (!m_bordered)
+      return static_cast<wchar_t>(m_text[lineStart + column]);
+
+   int lastColumn = m_width - 1;
+   if (row == 0)
+      return column == 0 ? m_topLeft : (column == lastColumn ? m_topRight : m_topEdge);
+   if (row == m_height - 1)
+      return column == 0 ? m_bottomLeft : (column == lastColumn ? m_bottomRight : m_bottomEdge);
+   if (column == 0)
+      return m_leftEdge;
+   if (column == lastColumn)
+      return m_rightEdge;
+
+   size_t textColumn = static_cast<size_t>(column - 1);
+   return textColumn < lineLength ? static_cast<wchar_t>(m_text[lineStart + textColumn]) : L' ';
+}
+
+// public ----------------------------------------------------------------------------------------------------
+LabelChange TextLabel::apply(Sprite& sprite)
+{
+   if (m_pendingChange == LabelChange::NONE)
+      return LabelChange::NONE;
+
+   LabelChange change = m_pendingChange;
+   m_text.swap(m_pendingText);
+   m_lineLengths.swap(m_pendingLineLengths);
+   m_width         = m_pendingWidth;
+   m_height        = m_pendingHeight;
+   m_drawn         = true;
+   m_pendingChange = LabelChange::NONE;
+
+   // Bordered rows hold all m_width cells, borderless rows just their line, row after row
+   size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+   if (!m_bordered)
+   {
+      cells = 0;
+      for (size_t lineLength : m_lineLengths)
+      {
+         cells += lineLength;
+      }
+   }
+
+   // Something else replaced the cells, a hot reload of the art for one
+   std::vector<Pixel>& pixels = sprite.getPixelsMutable();
+   if (change == LabelChange::GLYPHS && pixels.size() != cells)
+      change = LabelChange::CELLS;
+
+   Position anchor   = sprite.getAnchor();
+   int      firstRow = m_bordered ? 1 : 0;
+   size_t   index    = 0;
+   if (change != LabelChange::GLYPHS)
+   {
+      pixels.clear();
+      pixels.reserve(cells);
+   }
+
+   for (int row = 0; row < m_height; row++)
+   {
+      // Lines start one past the previous line's '\n', border rows have no line
+      int    line       = row - firstRow;
+      bool   hasLine    = line >= 0 && line < static_cast<int>(m_lineLengths.size());
+      size_t lineLength = hasLine ? m_lineLengths[line] : 0;
+      size_t lineStart  = 0;
+      for (int previous = 0; hasLine && previous < line; previous++)
+      {
+         lineStart += m_lineLengths[previous] + 1;
+      }
+
+      int columns = m_bordered ? m_width : static_cast<int>(lineLength);
+      for (int column = 0; column < columns; column++, index++)
+      {
+         wchar_t glyph = getGlyph(column, row, lineStart, lineLength);
+         if (change != LabelChange::GLYPHS)
+         {
+            pixels.push_back(Pixel(Position(anchor.getX() + column, anchor.getY() + row), glyph));
+         }
+         else if (pixels[index].getCharacter() != glyph)
+         {
+            pixels[index].setCharacter(glyph);
+         }
+      }
+   }
+   return change;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool TextLabel::getCellIndex(const size_t column, const size_t row, size_t& index) const
+{
+   if (!m_drawn || row >= m_lineLengths.size() || column >= m_lineLengths[row])
+      return false;
+
+   if (m_bordered)
+   {
+      index = (row + 1) * static_cast<size_t>(m_width) + column + 1;
+      return true;
+   }
+
+   index = column;
+   for (size_t line = 0; line < row; line++)
+   {
+      index += m_lineLengths[line];
+   }
+   return true;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+const std::string& TextLabel::getText() const
+{
+   return m_text;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool TextLabel::isBordered() const
+{
+   return m_bordered;
+}
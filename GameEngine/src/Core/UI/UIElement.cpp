@@ -13,8 +13,6 @@
 #include "../../../include/Parameters.h"
 #include <algorithm>
 #include <climits>
-#include <map>
-#include <set>
 
 // Initialize static member variables
 std::vector<std::shared_ptr<UIElement>> UIElement::topMiddleUIElements;
@@ -27,6 +25,18 @@ std::vector<std::shared_ptr<UIElement>> UIElement::topRightUIElements;
 std::vector<std::shared_ptr<UIElement>> UIElement::bottomLeftUIElements;
 std::vector<std::shared_ptr<UIElement>> UIElement::bottomRightUIElements;
 
+// Anchor groups in layout order
+static std::vector<std::shared_ptr<UIElement>>* const anchorGroups[9] = {
+      &UIElement::topMiddleUIElements,  &UIElement::rightMiddleUIElements, &UIElement::bottomMiddleUIElements,
+      &UIElement::leftMiddleUIElements, &UIElement::middleUIElements,      &UIElement::topLeftUIElements,
+      &UIElement::topRightUIElements,   &UIElement::bottomLeftUIElements,  &UIElement::bottomRightUIElements};
+
+// Bumped whenever an element joins or leaves an anchor group, the groups are laid out again
+static unsigned long anchorMembershipVersion = 1;
+
+// Elements of the group being laid out, kept between passes so a pass does not allocate
+static std::vector<UIElement*> groupElements;
+
 // public ----------------------------------------------------------------------------------------------------
 UIElement::UIElement()
 {
@@ -46,6 +56,17 @@ UIElement::UIElement()
    m_borderWidth    = 0;
    m_borderHeight   = 0;
    m_borderAutoSize = true;
+
+   m_layoutSize         = Position(0, 0);
+   m_layoutDirty        = true;
+   m_layoutWindow       = nullptr;
+   m_layoutArea         = Position(0, 0);
+   m_layoutPosition     = Position(0, 0);
+   m_layoutGroupVersion = 0;
+   m_measuredAnimation  = nullptr;
+   m_measuredVersion    = 0;
+   m_measuredFrameIndex = 0;
+   m_measuredPixelCount = 0;
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -66,6 +87,17 @@ UIElement::UIElement(const std::string printableName, const std::vector<Animatio
    m_borderHeight   = 0;
    m_borderAutoSize = true;
 
+   m_layoutSize         = Position(0, 0);
+   m_layoutDirty        = true;
+   m_layoutWindow       = nullptr;
+   m_layoutArea         = Position(0, 0);
+   m_layoutPosition     = Position(0, 0);
+   m_layoutGroupVersion = 0;
+   m_measuredAnimation  = nullptr;
+   m_measuredVersion    = 0;
+   m_measuredFrameIndex = 0;
+   m_measuredPixelCount = 0;
+
    setPositions();
 };
 
@@ -75,8 +107,10 @@ void UIElement::setPositions()
    m_minPosition = getCurrentAnimation().getCurrentFrameSprite().getAnchor();
    int maxX      = 0;
    int maxY      = 0;
+   int width     = 1;
+   int height    = 1;
 
-   for (Animation animation : getAnimations())
+   for (const Animation& animation : getAnimations())
    {
       if (animation.getAnimationName() == getCurrentAnimationName())
       {
@@ -86,11 +120,61 @@ void UIElement::setPositions()
                maxX = pixel.getPosition().getX();
             if (pixel.getPosition().getY() > maxY)
                maxY = pixel.getPosition().getY();
+            width  = std::max(width, pixel.getPosition().getX() - m_minPosition.getX() + 1);
+            height = std::max(height, pixel.getPosition().getY() - m_minPosition.getY() + 1);
          }
       }
    }
 
    m_maxPosition = Position(maxX, maxY);
+   uiLayoutVersion++;
+
+   const Animation& measured = getCurrentAnimation();
+   m_measuredAnimation       = &measured;
+   m_measuredVersion         = measured.getTimingVersion();
+   m_measuredFrameIndex      = measured.getCurrentFrameIndex();
+   m_measuredPixelCount      = measured.getCurrentFrameSprite().getPixels().size();
+
+   // A new size moves the rest of the element's group, the next layout pass places them again
+   if (width != m_layoutSize.getX() || height != m_layoutSize.getY())
+   {
+      m_layoutSize  = Position(width, height);
+      m_layoutDirty = true;
+   }
+};
+
+// private ---------------------------------------------------------------------------------------------------
+bool UIElement::isMeasurementStale() const
+{
+   const Animation& current = getCurrentAnimation();
+   return m_measuredAnimation != &current || m_measuredVersion != current.getTimingVersion() ||
+          m_measuredFrameIndex != current.getCurrentFrameIndex() ||
+          m_measuredPixelCount != current.getCurrentFrameSprite().getPixels().size();
+};
+
+// protected -------------------------------------------------------------------------------------------------
+bool UIElement::needsLayout(WINDOW* window, Position area)
+{
+   return m_layoutDirty || m_layoutWindow != window || !(m_layoutArea == area) ||
+          m_layoutGroupVersion != anchorMembershipVersion ||
+          !(m_layoutPosition == getCurrentAnimation().getCurrentFrameSprite().getAnchor());
+};
+
+// protected -------------------------------------------------------------------------------------------------
+void UIElement::place(Position position, WINDOW* window, Position area)
+{
+   if (!(position == getCurrentAnimation().getCurrentFrameSprite().getAnchor()))
+      moveToPosition(position);
+
+   m_minPosition = position;
+   m_maxPosition =
+         Position(position.getX() + m_layoutSize.getX() - 1, position.getY() + m_layoutSize.getY() - 1);
+
+   m_layoutDirty        = false;
+   m_layoutWindow       = window;
+   m_layoutArea         = area;
+   m_layoutPosition     = position;
+   m_layoutGroupVersion = anchorMembershipVersion;
 };
 
 // public ----------------------------------------------------------------------------------------------------
@@ -101,6 +185,7 @@ void UIElement::setDynamicPosition(ScreenLockPosition position, StackDirection d
 
    m_lockPosition   = position;
    m_stackDirection = direction;
+   anchorMembershipVersion++;
 
    // Helper function to check if element is already in vector
    auto addIfNotPresent = [this](std::vector<std::shared_ptr<UIElement>>& vec)
@@ -151,293 +236,222 @@ void UIElement::setDynamicPosition(ScreenLockPosition position, StackDirection d
 // public ----------------------------------------------------------------------------------------------------
 void UIElement::updateWindowLockedPositions(WINDOW* targetWindow)
 {
-   // Helper lambdas
-   auto elementWidth = [](const std::shared_ptr<UIElement>& el)
-   { return el->m_maxPosition.getX() - el->m_minPosition.getX() + 1; };
-   auto elementHeight = [](const std::shared_ptr<UIElement>& el)
-   { return el->m_maxPosition.getY() - el->m_minPosition.getY() + 1; };
-
-   // Helper function to find NcursesWindow from WINDOW*
-   auto findNcursesWindow = [](WINDOW* window) -> std::shared_ptr<NcursesWindow>
+   auto elementWindow = [](const std::shared_ptr<UIElement>& el)
+   { return el->getNcurseWindow() ? el->getNcurseWindow() : stdscr; };
+   auto elementWidth  = [](const UIElement* el) { return el->m_layoutSize.getX(); };
+   auto elementHeight = [](const UIElement* el) { return el->m_layoutSize.getY(); };
+
+   // An element moved to another window leaves a gap in the group it left, lay every group out again
+   for (std::vector<std::shared_ptr<UIElement>>* group : anchorGroups)
    {
-      for (auto& ncursesWindow : ncursesWindows)
+      for (const std::shared_ptr<UIElement>& el : *group)
       {
-         if (ncursesWindow->getWindow() == window)
+         WINDOW* window = elementWindow(el);
+         if (el->m_layoutWindow && el->m_layoutWindow != window)
          {
-            return ncursesWindow;
+            el->m_layoutWindow = window;
+            anchorMembershipVersion++;
          }
       }
-      return nullptr;
-   };
+   }
 
-   // Filter elements to only process those associated with the target window
-   auto filterWindowElements = [targetWindow](const std::vector<std::shared_ptr<UIElement>>& elements)
+   // Get window dimensions and adjust for borders if enabled
+   int windowHeight, windowLength;
+   getmaxyx(targetWindow, windowHeight, windowLength);
+
+   int borderPadding = 0;
+   for (auto& ncursesWindow : ncursesWindows)
    {
-      std::vector<std::shared_ptr<UIElement>> filtered;
-      for (auto& el : elements)
+      if (ncursesWindow->getWindow() == targetWindow)
       {
-         WINDOW* window = el->getNcurseWindow();
-         if ((!window && targetWindow == stdscr) || window == targetWindow)
+         if (ncursesWindow->isBorderEnabled())
          {
-            filtered.push_back(el);
+            borderPadding = 1; // 1 character padding on each side for borders
+            windowHeight -= 2; // Top and bottom border
+            windowLength -= 2; // Left and right border
          }
+         break;
       }
-      return filtered;
-   };
-
-   // Filter each position group to only include target window elements
-   auto filteredTopMiddle    = filterWindowElements(topMiddleUIElements);
-   auto filteredRightMiddle  = filterWindowElements(rightMiddleUIElements);
-   auto filteredBottomMiddle = filterWindowElements(bottomMiddleUIElements);
-   auto filteredLeftMiddle   = filterWindowElements(leftMiddleUIElements);
-   auto filteredMiddle       = filterWindowElements(middleUIElements);
-   auto filteredTopLeft      = filterWindowElements(topLeftUIElements);
-   auto filteredTopRight     = filterWindowElements(topRightUIElements);
-   auto filteredBottomLeft   = filterWindowElements(bottomLeftUIElements);
-   auto filteredBottomRight  = filterWindowElements(bottomRightUIElements);
-
-   // Group filtered elements by their window
-   std::map<WINDOW*, std::vector<std::shared_ptr<UIElement>>> windowGroups[9];
-
-   // Helper function to add elements to window groups
-   auto addToWindowGroup = [&](const std::vector<std::shared_ptr<UIElement>>& elements, int groupIndex)
-   {
-      for (auto& el : elements)
-      {
-         WINDOW* window = el->getNcurseWindow();
-         if (!window)
-            window = stdscr;
-         windowGroups[groupIndex][window].push_back(el);
-      }
-   };
+   }
+   Position area(windowLength, windowHeight);
 
-   // Group all filtered elements by window and position
-   addToWindowGroup(filteredTopMiddle, 0);
-   addToWindowGroup(filteredRightMiddle, 1);
-   addToWindowGroup(filteredBottomMiddle, 2);
-   addToWindowGroup(filteredLeftMiddle, 3);
-   addToWindowGroup(filteredMiddle, 4);
-   addToWindowGroup(filteredTopLeft, 5);
-   addToWindowGroup(filteredTopRight, 6);
-   addToWindowGroup(filteredBottomLeft, 7);
-   addToWindowGroup(filteredBottomRight, 8);
-
-   // Process each window
    for (int groupIndex = 0; groupIndex < 9; ++groupIndex)
    {
-      for (auto& [window, elements] : windowGroups[groupIndex])
+      // Gather the group's elements in this window, a group where nothing changed keeps its layout
+      bool dirty = false;
+      groupElements.clear();
+      for (const std::shared_ptr<UIElement>& el : *anchorGroups[groupIndex])
       {
-         if (elements.empty())
+         if (elementWindow(el) != targetWindow)
             continue;
 
-         // Get window dimensions and adjust for borders if enabled
-         int windowHeight, windowLength;
-         getmaxyx(window, windowHeight, windowLength);
+         // Never measured, or reshaped by a path that does not measure (replaced frames, animation switch)
+         if (el->isMeasurementStale())
+            el->setPositions();
+         dirty = dirty || el->needsLayout(targetWindow, area);
+         groupElements.push_back(el.get());
+      }
+      if (!dirty)
+         continue;
 
-         // Check if this window has borders and adjust usable area
-         auto ncursesWindow = findNcursesWindow(window);
-         int  borderPadding = 0;
-         if (ncursesWindow && ncursesWindow->isBorderEnabled())
+      // Sizes are the ones setPositions measured, each element is moved once by the offset to its place
+      switch (groupIndex)
+      {
+         case 0: // TOP MIDDLE
          {
-            borderPadding = 1; // 1 character padding on each side for borders
-            windowHeight -= 2; // Top and bottom border
-            windowLength -= 2; // Left and right border
+            int totalWidth = 0;
+            for (UIElement* el : groupElements)
+            {
+               totalWidth += elementWidth(el);
+            }
+            int dx = (windowLength - totalWidth) / 2 + borderPadding;
+            for (UIElement* el : groupElements)
+            {
+               el->place(Position(dx, borderPadding), targetWindow, area);
+               dx += elementWidth(el);
+            }
+            break;
          }
-
-         // Process elements based on their position type
-         switch (groupIndex)
+         case 1: // RIGHT MIDDLE
          {
-            case 0: // TOP MIDDLE
+            int totalHeight = 0;
+            for (UIElement* el : groupElements)
             {
-               int totalWidth = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-               }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(dx, borderPadding));
-                  el->setPositions();
-                  dx += elementWidth(el);
-               }
-               break;
+               totalHeight += elementHeight(el);
             }
-            case 1: // RIGHT MIDDLE
+            int dy = (windowHeight - totalHeight) / 2 + borderPadding;
+            for (UIElement* el : groupElements)
             {
-               int totalHeight = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalHeight += elementHeight(el);
-               }
-               int dy = (windowHeight - totalHeight) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  int x = windowLength - elementWidth(el) + borderPadding;
-                  el->moveToPosition(Position(x, dy));
-                  el->setPositions();
-                  dy += elementHeight(el);
-               }
-               break;
+               int x = windowLength - elementWidth(el) + borderPadding;
+               el->place(Position(x, dy), targetWindow, area);
+               dy += elementHeight(el);
             }
-            case 2: // BOTTOM MIDDLE
+            break;
+         }
+         case 2: // BOTTOM MIDDLE
+         {
+            int totalWidth = 0;
+            for (UIElement* el : groupElements)
             {
-               int totalWidth = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-               }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               int y  = windowHeight - 1 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(dx, y - elementHeight(el) + 1));
-                  el->setPositions();
-                  dx += elementWidth(el);
-               }
-               break;
+               totalWidth += elementWidth(el);
+            }
+            int dx = (windowLength - totalWidth) / 2 + borderPadding;
+            int y  = windowHeight - 1 + borderPadding;
+            for (UIElement* el : groupElements)
+            {
+               el->place(Position(dx, y - elementHeight(el) + 1), targetWindow, area);
+               dx += elementWidth(el);
             }
-            case 3: // LEFT MIDDLE
+            break;
+         }
+         case 3: // LEFT MIDDLE
+         {
+            int totalHeight = 0;
+            for (UIElement* el : groupElements)
+            {
+               totalHeight += elementHeight(el);
+            }
+            int dy = (windowHeight - totalHeight) / 2 + borderPadding;
+            for (UIElement* el : groupElements)
             {
-               int totalHeight = 0;
-               for (auto& el : elements)
+               el->place(Position(borderPadding, dy), targetWindow, area);
+               dy += elementHeight(el);
+            }
+            break;
+         }
+         case 4: // CENTER
+         {
+            int totalWidth = 0;
+            int maxHeight  = 0;
+            for (UIElement* el : groupElements)
+            {
+               totalWidth += elementWidth(el);
+               maxHeight = std::max(maxHeight, elementHeight(el));
+            }
+            int dx = (windowLength - totalWidth) / 2 + borderPadding;
+            int y  = (windowHeight - maxHeight) / 2 + borderPadding;
+            for (UIElement* el : groupElements)
+            {
+               el->place(Position(dx, y), targetWindow, area);
+               dx += elementWidth(el);
+            }
+            break;
+         }
+         case 5: // TOP LEFT CORNER
+         {
+            int dx = borderPadding;
+            int dy = borderPadding;
+            for (UIElement* el : groupElements)
+            {
+               el->place(Position(dx, dy), targetWindow, area);
+
+               if (el->m_stackDirection == StackDirection::HORIZONTAL)
                {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalHeight += elementHeight(el);
+                  dx += elementWidth(el);
                }
-               int dy = (windowHeight - totalHeight) / 2 + borderPadding;
-               for (auto& el : elements)
+               else
                {
-                  el->moveToPosition(Position(borderPadding, dy));
-                  el->setPositions();
                   dy += elementHeight(el);
                }
-               break;
             }
-            case 4: // CENTER
+            break;
+         }
+         case 6: // TOP RIGHT CORNER
+         {
+            int dx = windowLength + borderPadding;
+            int dy = borderPadding;
+            for (UIElement* el : groupElements)
             {
-               int totalWidth = 0;
-               int maxHeight  = 0;
-               for (auto& el : elements)
+               if (el->m_stackDirection == StackDirection::HORIZONTAL)
                {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-                  if (elementHeight(el) > maxHeight)
-                     maxHeight = elementHeight(el);
+                  dx -= elementWidth(el);
+                  el->place(Position(dx, dy), targetWindow, area);
                }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               int y  = (windowHeight - maxHeight) / 2 + borderPadding;
-               for (auto& el : elements)
+               else
                {
-                  el->moveToPosition(Position(dx, y));
-                  el->setPositions();
-                  dx += elementWidth(el);
+                  el->place(Position(dx - elementWidth(el), dy), targetWindow, area);
+                  dy += elementHeight(el);
                }
-               break;
             }
-            case 5: // TOP LEFT CORNER
+            break;
+         }
+         case 7: // BOTTOM LEFT CORNER
+         {
+            int dx = borderPadding;
+            int dy = windowHeight + borderPadding;
+            for (UIElement* el : groupElements)
             {
-               int dx = borderPadding;
-               int dy = borderPadding;
-               for (auto& el : elements)
+               if (el->m_stackDirection == StackDirection::HORIZONTAL)
                {
-                  el->setPositions();
-                  el->moveToPosition(Position(dx, dy));
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx += elementWidth(el);
-                  }
-                  else
-                  {
-                     dy += elementHeight(el);
-                  }
+                  el->place(Position(dx, dy - elementHeight(el)), targetWindow, area);
+                  dx += elementWidth(el);
                }
-               break;
-            }
-            case 6: // TOP RIGHT CORNER
-            {
-               int dx = windowLength + borderPadding;
-               int dy = borderPadding;
-               for (auto& el : elements)
+               else
                {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx -= elementWidth(el);
-                     el->moveToPosition(Position(dx, dy));
-                  }
-                  else
-                  {
-                     el->moveToPosition(Position(dx - elementWidth(el), dy));
-                     dy += elementHeight(el);
-                  }
-
-                  el->setPositions();
+                  dy -= elementHeight(el);
+                  el->place(Position(dx, dy), targetWindow, area);
                }
-               break;
             }
-            case 7: // BOTTOM LEFT CORNER
+            break;
+         }
+         case 8: // BOTTOM RIGHT CORNER
+         {
+            int dx = windowLength + borderPadding;
+            int dy = windowHeight + borderPadding;
+            for (UIElement* el : groupElements)
             {
-               int dx = borderPadding;
-               int dy = windowHeight + borderPadding;
-               for (auto& el : elements)
+               if (el->m_stackDirection == StackDirection::HORIZONTAL)
                {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     el->moveToPosition(Position(dx, dy - elementHeight(el)));
-                     dx += elementWidth(el);
-                  }
-                  else
-                  {
-                     dy -= elementHeight(el);
-                     el->moveToPosition(Position(dx, dy));
-                  }
-
-                  el->setPositions();
+                  dx -= elementWidth(el);
+                  el->place(Position(dx, dy - elementHeight(el)), targetWindow, area);
                }
-               break;
-            }
-            case 8: // BOTTOM RIGHT CORNER
-            {
-               int dx = windowLength + borderPadding;
-               int dy = windowHeight + borderPadding;
-               for (auto& el : elements)
+               else
                {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx -= elementWidth(el);
-                     el->moveToPosition(Position(dx, dy - elementHeight(el)));
-                  }
-                  else
-                  {
-                     dy -= elementHeight(el);
-                     el->moveToPosition(Position(dx - elementWidth(el), dy));
-                  }
-
-                  el->setPositions();
+                  dy -= elementHeight(el);
+                  el->place(Position(dx - elementWidth(el), dy), targetWindow, area);
                }
-               break;
             }
+            break;
          }
       }
    }
@@ -449,22 +463,21 @@ void UIElement::updateAllLockedPositions()
    // Clean up expired elements first
    cleanupExpiredElements();
 
-   // Update all windows by iterating through ncursesWindows
-   std::set<WINDOW*> processedWindows;
-
    // Always process stdscr first
    updateWindowLockedPositions(stdscr);
-   processedWindows.insert(stdscr);
 
-   // Process all other windows
-   for (auto& ncursesWindow : ncursesWindows)
+   // Process all other windows, once each
+   for (size_t i = 0; i < ncursesWindows.size(); i++)
    {
-      WINDOW* window = ncursesWindow->getWindow();
-      if (processedWindows.find(window) == processedWindows.end())
+      WINDOW* window    = ncursesWindows[i]->getWindow();
+      bool    processed = window == stdscr;
+      for (size_t j = 0; j < i && !processed; j++)
       {
-         updateWindowLockedPositions(window);
-         processedWindows.insert(window);
+         processed = ncursesWindows[j]->getWindow() == window;
       }
+
+      if (!processed)
+         updateWindowLockedPositions(window);
    }
 }
 
@@ -474,6 +487,7 @@ void UIElement::cleanupExpiredElements()
    // Helper function to remove elements that are no longer valid
    auto removeInactiveElements = [](std::vector<std::shared_ptr<UIElement>>& elements)
    {
+      size_t count = elements.size();
       elements.erase(std::remove_if(elements.begin(), elements.end(),
                                     [](const std::shared_ptr<UIElement>& elem)
                                     {
@@ -481,18 +495,15 @@ void UIElement::cleanupExpiredElements()
                                        return !elem;
                                     }),
                      elements.end());
+      if (elements.size() != count)
+         anchorMembershipVersion++;
    };
 
    // Clean up all positioning vectors
-   removeInactiveElements(topMiddleUIElements);
-   removeInactiveElements(rightMiddleUIElements);
-   removeInactiveElements(bottomMiddleUIElements);
-   removeInactiveElements(leftMiddleUIElements);
-   removeInactiveElements(middleUIElements);
-   removeInactiveElements(topLeftUIElements);
-   removeInactiveElements(topRightUIElements);
-   removeInactiveElements(bottomLeftUIElements);
-   removeInactiveElements(bottomRightUIElements);
+   for (std::vector<std::shared_ptr<UIElement>>* group : anchorGroups)
+   {
+      removeInactiveElements(*group);
+   }
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -501,315 +512,18 @@ void UIElement::removeFromPositioningVectors(std::shared_ptr<UIElement> element)
    if (!element)
       return;
 
-   // Helper function to remove element from a vector
-   auto removeFromVector = [&element](std::vector<std::shared_ptr<UIElement>>& vec)
-   { vec.erase(std::remove(vec.begin(), vec.end(), element), vec.end()); };
-
    // Remove from all positioning vectors
-   removeFromVector(topMiddleUIElements);
-   removeFromVector(rightMiddleUIElements);
-   removeFromVector(bottomMiddleUIElements);
-   removeFromVector(leftMiddleUIElements);
-   removeFromVector(middleUIElements);
-   removeFromVector(topLeftUIElements);
-   removeFromVector(topRightUIElements);
-   removeFromVector(bottomLeftUIElements);
-   removeFromVector(bottomRightUIElements);
+   for (std::vector<std::shared_ptr<UIElement>>* group : anchorGroups)
+   {
+      group->erase(std::remove(group->begin(), group->end(), element), group->end());
+   }
+   anchorMembershipVersion++;
 }
 
 // public ----------------------------------------------------------------------------------------------------
 void UIElement::updateStdscrLockedPositions()
 {
-   // Helper lambdas
-   auto elementWidth = [](const std::shared_ptr<UIElement>& el)
-   { return el->m_maxPosition.getX() - el->m_minPosition.getX() + 1; };
-   auto elementHeight = [](const std::shared_ptr<UIElement>& el)
-   { return el->m_maxPosition.getY() - el->m_minPosition.getY() + 1; };
-
-   // Helper function to find NcursesWindow from WINDOW*
-   auto findNcursesWindow = [](WINDOW* window) -> std::shared_ptr<NcursesWindow>
-   {
-      for (auto& ncursesWindow : ncursesWindows)
-      {
-         if (ncursesWindow->getWindow() == window)
-         {
-            return ncursesWindow;
-         }
-      }
-      return nullptr;
-   };
-
-   // Filter elements to only process those associated with stdscr
-   auto filterStdscrElements = [](const std::vector<std::shared_ptr<UIElement>>& elements)
-   {
-      std::vector<std::shared_ptr<UIElement>> filtered;
-      for (auto& el : elements)
-      {
-         WINDOW* window = el->getNcurseWindow();
-         if (!window || window == stdscr)
-         {
-            filtered.push_back(el);
-         }
-      }
-      return filtered;
-   };
-
-   // Filter each position group to only include stdscr elements
-   auto filteredTopMiddle    = filterStdscrElements(topMiddleUIElements);
-   auto filteredRightMiddle  = filterStdscrElements(rightMiddleUIElements);
-   auto filteredBottomMiddle = filterStdscrElements(bottomMiddleUIElements);
-   auto filteredLeftMiddle   = filterStdscrElements(leftMiddleUIElements);
-   auto filteredMiddle       = filterStdscrElements(middleUIElements);
-   auto filteredTopLeft      = filterStdscrElements(topLeftUIElements);
-   auto filteredTopRight     = filterStdscrElements(topRightUIElements);
-   auto filteredBottomLeft   = filterStdscrElements(bottomLeftUIElements);
-   auto filteredBottomRight  = filterStdscrElements(bottomRightUIElements);
-
-   // Group filtered elements by their window (should only be stdscr now)
-   std::map<WINDOW*, std::vector<std::shared_ptr<UIElement>>> windowGroups[9];
-
-   // Helper function to add elements to window groups
-   auto addToWindowGroup = [&](const std::vector<std::shared_ptr<UIElement>>& elements, int groupIndex)
-   {
-      for (auto& el : elements)
-      {
-         WINDOW* window = el->getNcurseWindow();
-         if (!window)
-            window = stdscr;
-         windowGroups[groupIndex][window].push_back(el);
-      }
-   };
-
-   // Group all filtered elements by window and position
-   addToWindowGroup(filteredTopMiddle, 0);
-   addToWindowGroup(filteredRightMiddle, 1);
-   addToWindowGroup(filteredBottomMiddle, 2);
-   addToWindowGroup(filteredLeftMiddle, 3);
-   addToWindowGroup(filteredMiddle, 4);
-   addToWindowGroup(filteredTopLeft, 5);
-   addToWindowGroup(filteredTopRight, 6);
-   addToWindowGroup(filteredBottomLeft, 7);
-   addToWindowGroup(filteredBottomRight, 8);
-
-   // Process each window (should only be stdscr)
-   for (int groupIndex = 0; groupIndex < 9; ++groupIndex)
-   {
-      for (auto& [window, elements] : windowGroups[groupIndex])
-      {
-         if (elements.empty())
-            continue;
-
-         // Get window dimensions and adjust for borders if enabled
-         int windowHeight, windowLength;
-         getmaxyx(window, windowHeight, windowLength);
-
-         // Check if this window has borders and adjust usable area
-         auto ncursesWindow = findNcursesWindow(window);
-         int  borderPadding = 0;
-         if (ncursesWindow && ncursesWindow->isBorderEnabled())
-         {
-            borderPadding = 1;
-            windowHeight -= 2;
-            windowLength -= 2;
-         }
-
-         // Process elements based on their position type (same logic as updateAllLockedPositions)
-         switch (groupIndex)
-         {
-            case 0: // TOP MIDDLE
-            {
-               int totalWidth = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-               }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(dx, borderPadding));
-                  el->setPositions();
-                  dx += elementWidth(el);
-               }
-               break;
-            }
-            case 1: // RIGHT MIDDLE
-            {
-               int totalHeight = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalHeight += elementHeight(el);
-               }
-               int dy = (windowHeight - totalHeight) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  int x = windowLength - elementWidth(el) + borderPadding;
-                  el->moveToPosition(Position(x, dy));
-                  el->setPositions();
-                  dy += elementHeight(el);
-               }
-               break;
-            }
-            case 2: // BOTTOM MIDDLE
-            {
-               int totalWidth = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-               }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               int y  = windowHeight - 1 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(dx, y - elementHeight(el) + 1));
-                  el->setPositions();
-                  dx += elementWidth(el);
-               }
-               break;
-            }
-            case 3: // LEFT MIDDLE
-            {
-               int totalHeight = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalHeight += elementHeight(el);
-               }
-               int dy = (windowHeight - totalHeight) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(borderPadding, dy));
-                  el->setPositions();
-                  dy += elementHeight(el);
-               }
-               break;
-            }
-            case 4: // CENTER
-            {
-               int totalWidth = 0;
-               int maxHeight  = 0;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(0, 0));
-                  el->setPositions();
-                  totalWidth += elementWidth(el);
-                  if (elementHeight(el) > maxHeight)
-                     maxHeight = elementHeight(el);
-               }
-               int dx = (windowLength - totalWidth) / 2 + borderPadding;
-               int y  = (windowHeight - maxHeight) / 2 + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->moveToPosition(Position(dx, y));
-                  el->setPositions();
-                  dx += elementWidth(el);
-               }
-               break;
-            }
-            case 5: // TOP LEFT CORNER
-            {
-               int dx = borderPadding;
-               int dy = borderPadding;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-                  el->moveToPosition(Position(dx, dy));
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx += elementWidth(el);
-                  }
-                  else
-                  {
-                     dy += elementHeight(el);
-                  }
-               }
-               break;
-            }
-            case 6: // TOP RIGHT CORNER
-            {
-               int dx = windowLength + borderPadding;
-               int dy = borderPadding;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx -= elementWidth(el);
-                     el->moveToPosition(Position(dx, dy));
-                  }
-                  else
-                  {
-                     el->moveToPosition(Position(dx - elementWidth(el), dy));
-                     dy += elementHeight(el);
-                  }
-
-                  el->setPositions();
-               }
-               break;
-            }
-            case 7: // BOTTOM LEFT CORNER
-            {
-               int dx = borderPadding;
-               int dy = windowHeight + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     el->moveToPosition(Position(dx, dy - elementHeight(el)));
-                     dx += elementWidth(el);
-                  }
-                  else
-                  {
-                     dy -= elementHeight(el);
-                     el->moveToPosition(Position(dx, dy));
-                  }
-
-                  el->setPositions();
-               }
-               break;
-            }
-            case 8: // BOTTOM RIGHT CORNER
-            {
-               int dx = windowLength + borderPadding;
-               int dy = windowHeight + borderPadding;
-               for (auto& el : elements)
-               {
-                  el->setPositions();
-
-                  if (el->m_stackDirection == StackDirection::HORIZONTAL)
-                  {
-                     dx -= elementWidth(el);
-                     el->moveToPosition(Position(dx, dy - elementHeight(el)));
-                  }
-                  else
-                  {
-                     dy -= elementHeight(el);
-                     el->moveToPosition(Position(dx - elementWidth(el), dy));
-                  }
-
-                  el->setPositions();
-               }
-               break;
-            }
-         }
-      }
-   }
+   updateWindowLockedPositions(stdscr);
 }
 
 // public ----------------------------------------------------------------------------------------------------
@@ -817,6 +531,7 @@ void UIElement::displace(int dx, int dy)
 {
    m_minPosition = Position(m_minPosition.getX() + dx, m_minPosition.getY() + dy);
    m_maxPosition = Position(m_maxPosition.getX() + dx, m_maxPosition.getY() + dy);
+   uiLayoutVersion++;
    for (Animation& animation : m_animations)
    {
       if (m_currentAnimationName == animation.getAnimationName())
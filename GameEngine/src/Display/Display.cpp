@@ -11,10 +11,21 @@
 
 #include "../../include/Display.h"
 #include "../../include/ColorManager.h"
+#include "../../include/InputRecorder.h"
 #include "../../include/Parameters.h"
 #include "../../include/UIElement.h"
 #include <ncursesw/ncurses.h>
+#include <cstdio>
 #include <cwchar>
+#include <iostream>
+#include <limits>
+
+// Terminal type of the headless screen a replay draws into
+static const char* HEADLESS_TERMINAL = "xterm-256color";
+
+static SCREEN* headlessScreen = nullptr;
+static FILE*   headlessOutput = nullptr;
+static FILE*   headlessInput  = nullptr;
 
 // public static ---------------------------------------------------------------------------------------------
 void Display::removeWindow(std::shared_ptr<NcursesWindow> window)
@@ -29,7 +40,28 @@ void Display::removeWindow(std::shared_ptr<NcursesWindow> window)
 void Display::initCurse()
 {
    setlocale(LC_ALL, "");
-   initscr(); // Start curses mode
+
+   // A replay never reads the terminal and only checks framebuffer hashes, so it draws into /dev/null with a
+   // fixed terminal type and runs the same without a terminal, e.g. in CI
+   if (InputRecorder::isReplaying())
+   {
+      headlessOutput = fopen("/dev/null", "w");
+      headlessInput  = fopen("/dev/null", "r");
+      if (headlessOutput != nullptr && headlessInput != nullptr)
+      {
+         headlessScreen = newterm(HEADLESS_TERMINAL, headlessOutput, headlessInput);
+      }
+      if (headlessScreen == nullptr)
+      {
+         std::cerr << "Warning: could not open a headless " << HEADLESS_TERMINAL
+                   << " screen, replaying on the terminal" << std::endl;
+      }
+   }
+
+   if (headlessScreen == nullptr)
+   {
+      initscr(); // Start curses mode
+   }
    refresh();
    curs_set(0);
    noecho();
@@ -38,7 +70,10 @@ void Display::initCurse()
    nodelay(stdscr, TRUE);
    mousemask(ALL_MOUSE_EVENTS | REPORT_MOUSE_POSITION, NULL);
    mouseinterval(0);
-   printf("\033[?1003h\n"); // Enable mouse tracking
+   if (headlessScreen == nullptr)
+   {
+      printf("\033[?1003h\033[?1006h\n"); // Enable mouse tracking, reported in SGR form for any column
+   }
 
    getmaxyx(stdscr, SCREEN_HEIGHT, SCREEN_LENGTH);
 
@@ -57,17 +92,30 @@ void Display::initCurse()
    UIElement::updateAllLockedPositions();
 }
 
-// public static ---------------------------------------------------------------------------------------------
-char Display::getUserInput()
-{
-   return getch();
-}
-
 // public static ---------------------------------------------------------------------------------------------
 void Display::closeCurseWindow()
 {
-   printf("\033[?1003l\n"); // Disable mouse tracking
+   if (headlessScreen == nullptr)
+   {
+      printf("\033[?1006l\033[?1003l\n"); // Disable mouse tracking
+   }
    endwin();
+
+   if (headlessScreen != nullptr)
+   {
+      delscreen(headlessScreen);
+      headlessScreen = nullptr;
+   }
+   if (headlessOutput != nullptr)
+   {
+      fclose(headlessOutput);
+      headlessOutput = nullptr;
+   }
+   if (headlessInput != nullptr)
+   {
+      fclose(headlessInput);
+      headlessInput = nullptr;
+   }
 }
 
 // private static --------------------------------------------------------------------------------------------
@@ -113,4 +161,35 @@ void Display::refreshDisplay(float deltaTime)
 
    // Reset global display clear flag after all windows have been processed
    displayNeedsCleared = false;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+float Display::getTimeUntilNextChange()
+{
+   if (displayNeedsCleared)
+   {
+      return 0.0f;
+   }
+
+   // Sub-windows are covered by their parent's query
+   float timeUntilNextChange = std::numeric_limits<float>::infinity();
+   for (auto& window : ncursesWindows)
+   {
+      if (!window->isSubWindow())
+      {
+         timeUntilNextChange = std::min(timeUntilNextChange, window->getTimeUntilNextChange());
+      }
+   }
+   return timeUntilNextChange;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+uint64_t Display::hashFrameBuffers()
+{
+   uint64_t hash = 14695981039346656037ULL; // FNV-1a offset basis
+   for (auto& window : ncursesWindows)
+   {
+      hash = window->hashFrameBuffer(hash);
+   }
+   return hash;
 }
\ No newline at end of file
@@ -62,6 +62,8 @@ NcursesWindow::NcursesWindow(int length, int height, int windowLayer, bool isMov
    m_minHeight            = 3;
    m_isSubWindow          = false;
 
+   m_trackedAnimationVersion = 0;
+
    clearBuffer();
 };
 
@@ -84,6 +86,8 @@ NcursesWindow::NcursesWindow(WINDOW* window, int windowLayer, bool isMoveableByC
    m_minHeight            = 3;
    m_isSubWindow          = false;
 
+   m_trackedAnimationVersion = 0;
+
    getmaxyx(m_window, m_currentHeight, m_currentLength);
    m_originalHeight = m_currentHeight;
    m_originalLength = m_currentLength;
@@ -115,6 +119,8 @@ NcursesWindow::NcursesWindow(bool autoResize, int windowLayer, bool isMoveableBy
    m_minHeight            = std::max(1, minHeight);
    m_isSubWindow          = false;
 
+   m_trackedAnimationVersion = 0;
+
    clearBuffer();
 }
 
@@ -122,6 +128,7 @@ NcursesWindow::NcursesWindow(bool autoResize, int windowLayer, bool isMoveableBy
 void NcursesWindow::addPrintable(std::shared_ptr<Printable> printable)
 {
    m_containedPrintables.push_back(printable);
+   animationTrackingVersion++;
 
    // Trigger auto-resize if enabled
    if (m_autoResize)
@@ -136,6 +143,7 @@ void NcursesWindow::removePrintable(std::shared_ptr<Printable> printable)
    m_containedPrintables.erase(std::remove(m_containedPrintables.begin(), m_containedPrintables.end(),
                                            printable),
                                m_containedPrintables.end());
+   animationTrackingVersion++;
 
    // Trigger auto-resize if enabled
    if (m_autoResize)
@@ -148,6 +156,7 @@ void NcursesWindow::removePrintable(std::shared_ptr<Printable> printable)
 void NcursesWindow::clearPrintables()
 {
    m_containedPrintables.clear();
+   animationTrackingVersion++;
 
    // Trigger auto-resize if enabled
    if (m_autoResize)
@@ -156,6 +165,12 @@ void NcursesWindow::clearPrintables()
    }
 }
 
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<std::shared_ptr<Printable>>& NcursesWindow::getPrintables() const
+{
+   return m_containedPrintables;
+}
+
 // public ----------------------------------------------------------------------------------------------------
 const int& NcursesWindow::getWindowLayer() const
 {
@@ -238,6 +253,7 @@ void NcursesWindow::updateWindowPosition()
       if (currentX != newX || currentY != newY)
       {
          displayNeedsCleared = true;
+         uiLayoutVersion++;
       }
 
       mvwin(m_window, newY, newX);
@@ -260,6 +276,7 @@ void NcursesWindow::setBasePosition(const int x, const int y)
    if (m_basePositionX != x || m_basePositionY != y)
    {
       displayNeedsCleared = true;
+      uiLayoutVersion++;
    }
 
    m_basePositionX = x;
@@ -319,6 +336,110 @@ void NcursesWindow::eraseSprite(const Sprite sprite, const bool isMoveableByCame
    }
 }
 
+// public ----------------------------------------------------------------------------------------------------
+void NcursesWindow::printSpriteWithBackground(const Sprite& sprite, const Printable& printable)
+{
+   const std::vector<Pixel>& pixels = sprite.getPixels();
+   for (size_t i = 0; i < pixels.size(); i++)
+   {
+      if (printable.keepsOwnBackground(i))
+      {
+         printPixel(pixels[i], printable.isMoveableByCamera());
+         continue;
+      }
+
+      Pixel styled = pixels[i];
+      styled.setBackgroundColor(printable.getBackgroundOverride());
+      printPixel(styled, printable.isMoveableByCamera());
+   }
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void NcursesWindow::printSpriteAtOffset(const Sprite& sprite, const int offsetX, const int offsetY,
+                                        const bool isMoveableByCamera)
+{
+   int baseX = offsetX;
+   int baseY = offsetY;
+   if (isMoveableByCamera && currentCamera)
+   {
+      baseX += currentCamera->getLengthOffset();
+      baseY += currentCamera->getHeightOffset();
+   }
+
+   for (const Pixel& pixel : sprite.getPixels())
+   {
+      int printedX = pixel.getPosition().getX() + baseX;
+      int printedY = pixel.getPosition().getY() + baseY;
+      if (printedX >= 0 && printedX < m_currentLength && printedY >= 0 && printedY < m_currentHeight)
+      {
+         m_currentFrameBuffer[printedY][printedX] = pixel;
+      }
+   }
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void NcursesWindow::eraseSpriteAtOffset(const Sprite& sprite, const int offsetX, const int offsetY,
+                                        const bool isMoveableByCamera)
+{
+   int baseX = offsetX;
+   int baseY = offsetY;
+   if (isMoveableByCamera && currentCamera)
+   {
+      baseX += currentCamera->getLengthOffset();
+      baseY += currentCamera->getHeightOffset();
+   }
+
+   const Pixel blank;
+   for (const Pixel& pixel : sprite.getPixels())
+   {
+      int printedX = pixel.getPosition().getX() + baseX;
+      int printedY = pixel.getPosition().getY() + baseY;
+      if (printedX >= 0 && printedX < m_currentLength && printedY >= 0 && printedY < m_currentHeight)
+      {
+         m_currentFrameBuffer[printedY][printedX] = blank;
+      }
+   }
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void NcursesWindow::printCell(const int x, const int y, const wchar_t character, const RGB& textColor,
+                              const bool isMoveableByCamera)
+{
+   int printedX = x;
+   int printedY = y;
+
+   if (isMoveableByCamera && currentCamera)
+   {
+      printedX += currentCamera->getLengthOffset();
+      printedY += currentCamera->getHeightOffset();
+   }
+
+   if (printedX >= 0 && printedX < m_currentLength && printedY >= 0 && printedY < m_currentHeight)
+   {
+      Pixel& cell = m_currentFrameBuffer[printedY][printedX];
+      cell.setCharacter(character);
+      cell.setTextColor(textColor);
+   }
+}
+
+// public ----------------------------------------------------------------------------------------------------
+void NcursesWindow::eraseCell(const int x, const int y, const bool isMoveableByCamera)
+{
+   int printedX = x;
+   int printedY = y;
+
+   if (isMoveableByCamera && currentCamera)
+   {
+      printedX += currentCamera->getLengthOffset();
+      printedY += currentCamera->getHeightOffset();
+   }
+
+   if (printedX >= 0 && printedX < m_currentLength && printedY >= 0 && printedY < m_currentHeight)
+   {
+      m_currentFrameBuffer[printedY][printedX] = Pixel();
+   }
+}
+
 // public ----------------------------------------------------------------------------------------------------
 void NcursesWindow::refreshWindow(const float deltaTime)
 {
@@ -508,44 +629,150 @@ void NcursesWindow::refreshPrintables(const float deltaTime)
       m_printablesNeedSorted = false;
    }
 
+   // Playing animations are only re-registered with the clock after one started or stopped playing, was
+   // shown, hidden or changed from outside the clock, not on every refresh
+   if (m_trackedAnimationVersion != animationTrackingVersion)
+   {
+      m_trackedAnimationVersion = animationTrackingVersion;
+      m_animationClock.beginTracking();
+      for (auto& printable : m_containedPrintables)
+      {
+         if (!printable->isVisable() || printable->isBatched())
+         {
+            continue;
+         }
+
+         for (Animation& animation : printable->getAnimationsMutable())
+         {
+            if (animation.getAnimationName() == printable->getCurrentAnimationName() &&
+                animation.isPlaying())
+            {
+               m_animationClock.track(printable.get(), &animation);
+            }
+         }
+      }
+      m_animationClock.endTracking();
+   }
+
+   // Step phase: only animations whose next frame change is due get stepped, before anything is drawn
+   m_animationClock.advance(deltaTime);
+
+   // Delta encoded animations only erase the cells their frame changes emptied. Done before the draw phase
+   // so printables underneath are drawn back over them, no display clear needed.
    for (auto& printable : m_containedPrintables)
    {
-      // Skip invisible printables
-      if (!printable->isVisable())
+      if (!printable->isVisable() || printable->isBatched())
       {
          continue;
       }
 
       for (Animation& animation : printable->getAnimationsMutable())
       {
-         if (animation.getAnimationName() == printable->getCurrentAnimationName())
+         if (animation.getAnimationName() == printable->getCurrentAnimationName() &&
+             animation.isDeltaEncoded() && !animation.getVacatedPositions().empty())
          {
-            if (animation.isPlaying())
+            for (const Position& position : animation.getVacatedPositions())
             {
-               size_t previousFrameIndex = animation.getCurrentFrameIndex();
-               animation.update(deltaTime);
+               eraseCell(position.getX(), position.getY(), printable->isMoveableByCamera());
+            }
+            animation.clearVacatedPositions();
+         }
+      }
+   }
 
-               // Check if frame actually advanced
-               if (animation.getCurrentFrameIndex() != previousFrameIndex)
-               {
-                  // Force display clear when animation frames advance to prevent after images
-                  m_displayNeedsCleared = true;
-               }
+   // Batched printables erase their last refresh here too, hidden ones included so they leave nothing behind
+   for (auto& printable : m_containedPrintables)
+   {
+      if (printable->isBatched())
+      {
+         printable->eraseBatched(*this);
+      }
+   }
 
-               printable->addDirtySprite(animation.getPreviousFrameSprite());
-            }
+   // Only printables that changed frame need their previous sprite erased
+   for (Printable* printable : m_animationClock.getChangedPrintables())
+   {
+      if (printable->getCurrentAnimation().isDeltaEncoded())
+      {
+         continue;
+      }
 
-            for (const Sprite& sprite : printable->getDirtySprites())
-            {
-               eraseSprite(sprite, printable->isMoveableByCamera());
-            }
-            printable->clearDirtySprites();
-            printSprite(animation.getCurrentFrameSprite(), printable->isMoveableByCamera());
+      printable->addDirtySprite(printable->getCurrentAnimation().getPreviousFrameSprite());
+   }
+
+   // Every dirty sprite is erased before anything is drawn, like the vacated cells above. Erasing in the
+   // draw phase would wipe printables already drawn underneath, which took a full display clear to avoid.
+   for (auto& printable : m_containedPrintables)
+   {
+      if (!printable->isVisable())
+      {
+         continue;
+      }
+
+      for (const Sprite& sprite : printable->getDirtySprites())
+      {
+         eraseSprite(sprite, printable->isMoveableByCamera());
+      }
+      printable->clearDirtySprites();
+   }
+
+   // Draw phase
+   for (auto& printable : m_containedPrintables)
+   {
+      // Skip invisible printables
+      if (!printable->isVisable())
+      {
+         continue;
+      }
+
+      // Batched printables rasterize straight into the frame buffer
+      if (printable->isBatched() && printable->drawToWindow(*this, deltaTime))
+      {
+         continue;
+      }
+
+      for (const Animation& animation : printable->getAnimations())
+      {
+         if (animation.getAnimationName() == printable->getCurrentAnimationName())
+         {
+            // Highlights and other overrides are applied here, the sprite itself is left untouched
+            if (printable->hasBackgroundOverride())
+               printSpriteWithBackground(animation.getCurrentFrameSprite(), *printable);
+            else
+               printSprite(animation.getCurrentFrameSprite(), printable->isMoveableByCamera());
          }
       }
    }
 }
 
+// public ----------------------------------------------------------------------------------------------------
+float NcursesWindow::getTimeUntilNextChange()
+{
+   if (m_displayNeedsCleared)
+   {
+      return 0.0f;
+   }
+
+   // Batched printables step themselves every refresh
+   for (const auto& printable : m_containedPrintables)
+   {
+      if (printable->isVisable() && printable->isBatched())
+      {
+         return 0.0f;
+      }
+   }
+
+   float timeUntilNextChange = m_animationClock.getTimeUntilNextChange();
+   for (const auto& subWindow : m_subWindows)
+   {
+      if (subWindow)
+      {
+         timeUntilNextChange = std::min(timeUntilNextChange, subWindow->getTimeUntilNextChange());
+      }
+   }
+   return timeUntilNextChange;
+}
+
 // public ----------------------------------------------------------------------------------------------------
 void NcursesWindow::setBorderEnabled(const bool enabled)
 {
@@ -872,4 +1099,42 @@ std::shared_ptr<NcursesWindow> NcursesWindow::getParentWindow() const
 bool NcursesWindow::isSubWindow() const
 {
    return m_isSubWindow;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static uint64_t hashValue(uint64_t hash, const int64_t value)
+{
+   for (int i = 0; i < 8; i++)
+   {
+      hash ^= static_cast<uint8_t>(value >> (i * 8));
+      hash *= 1099511628211ULL; // FNV-1a prime
+   }
+   return hash;
+}
+
+// public ----------------------------------------------------------------------------------------------------
+uint64_t NcursesWindow::hashFrameBuffer(uint64_t hash) const
+{
+   int x = 0, y = 0;
+   if (m_window)
+      getbegyx(m_window, y, x);
+   hash = hashValue(hash, x);
+   hash = hashValue(hash, y);
+   hash = hashValue(hash, m_currentLength);
+   hash = hashValue(hash, m_currentHeight);
+
+   for (const std::vector<Pixel>& row : m_currentFrameBuffer)
+   {
+      for (const Pixel& cell : row)
+      {
+         const RGB& text       = cell.getTextColor();
+         const RGB& background = cell.getBackgroundColor();
+         hash                  = hashValue(hash, cell.getCharacter());
+         hash = hashValue(hash, (static_cast<int64_t>(text.getR()) << 32) | (text.getG() << 16) | text.getB());
+         hash = hashValue(hash, (static_cast<int64_t>(background.getR()) << 32) | (background.getG() << 16) |
+                                      background.getB());
+         hash = hashValue(hash, cell.getAttributes());
+      }
+   }
+   return hash;
 }
\ No newline at end of file
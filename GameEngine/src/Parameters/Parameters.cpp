@@ -28,4 +28,20 @@ int  userInput           = 0;
 bool engineRunning       = false;
 bool displayNeedsCleared = false;
 
+unsigned long uiLayoutVersion = 0;
+
+std::atomic<unsigned long> animationTrackingVersion{0};
+
+InputQueue inputEvents;
+
+unsigned int randomSeed = 0;
+
+int maxIdleSleepMilliseconds = 16;
+
+unsigned int maxLoaderThreads = 8;
+
+size_t maxStreamBufferBytes = 16 * 1024 * 1024;
+
+bool trustAnimationArchives = false;
+
 InputHandler globalInputHandler;
\ No newline at end of file
@@ -0,0 +1,395 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationArchive.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationArchive for packing and reading animation archives
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/AnimationArchive.h"
+#include "../../include/ThreadPool.h"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(AnimationArchive::FrameEntry) == 24, "AnimationArchive::FrameEntry must be packed");
+static_assert(sizeof(AnimationArchive::Footer) == 24, "AnimationArchive::Footer must be packed");
+
+static const char   ANIMATION_ARCHIVE_MAGIC[4] = {'L', 'A', 'E', 'P'};
+static const size_t LZ_MIN_MATCH               = 4;
+static const size_t LZ_MAX_OFFSET              = 0xFFFF;
+static const int    LZ_HASH_BITS               = 14;
+
+// private static --------------------------------------------------------------------------------------------
+static bool readAt(const int fileDescriptor, void* buffer, const size_t size, const uint64_t offset)
+{
+   size_t done = 0;
+   while (done < size)
+   {
+      ssize_t count = pread(fileDescriptor, static_cast<char*>(buffer) + done, size - done,
+                            static_cast<off_t>(offset + done));
+      if (count <= 0)
+         return false;
+      done += static_cast<size_t>(count);
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendLength(std::string& out, size_t length)
+{
+   // Lengths past the token's 15 continue in bytes of 255 and a final byte below it
+   while (length >= 255)
+   {
+      out += static_cast<char>(255);
+      length -= 255;
+   }
+   out += static_cast<char>(length);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool readLength(const unsigned char*& cursor, const unsigned char* end, size_t& length)
+{
+   unsigned char next = 255;
+   while (next == 255)
+   {
+      if (cursor >= end)
+         return false;
+      next = *cursor++;
+      length += next;
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendSequence(std::string& out, const char* literals, const size_t literalCount,
+                           const size_t offset, const size_t matchLength)
+{
+   // Token: literal count in the high nibble, match length past the minimum in the low nibble
+   size_t matchExtra   = matchLength > 0 ? matchLength - LZ_MIN_MATCH : 0;
+   size_t literalToken = literalCount < 15 ? literalCount : 15;
+   size_t matchToken   = matchExtra < 15 ? matchExtra : 15;
+   out += static_cast<char>((literalToken << 4) | matchToken);
+   if (literalCount >= 15)
+      appendLength(out, literalCount - 15);
+   out.append(literals, literalCount);
+
+   // The last sequence is literals only and ends the data
+   if (matchLength == 0)
+      return;
+   out += static_cast<char>(offset & 0xFF);
+   out += static_cast<char>(offset >> 8);
+   if (matchExtra >= 15)
+      appendLength(out, matchExtra - 15);
+}
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationArchive::AnimationArchive()
+{
+   m_fileDescriptor = -1;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationArchive::AnimationArchive(const std::string fileLocation) : AnimationArchive()
+{
+   open(fileLocation);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationArchive::~AnimationArchive()
+{
+   close();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationArchive::open(const std::string fileLocation)
+{
+   close();
+
+   int fileDescriptor = ::open(fileLocation.c_str(), O_RDONLY);
+   if (fileDescriptor < 0)
+      return false;
+
+   struct stat fileStats;
+   Footer      footer;
+   uint64_t    fileSize = 0;
+   if (fstat(fileDescriptor, &fileStats) == 0)
+      fileSize = static_cast<uint64_t>(fileStats.st_size);
+
+   // Footer then index, both must sit inside the file before anything is read from them
+   bool valid = fileSize >= sizeof(Footer) &&
+                readAt(fileDescriptor, &footer, sizeof(Footer), fileSize - sizeof(Footer)) &&
+                std::memcmp(footer.magic, ANIMATION_ARCHIVE_MAGIC, sizeof(ANIMATION_ARCHIVE_MAGIC)) == 0 &&
+                footer.version == VERSION &&
+                footer.indexOffset + footer.indexSize + sizeof(Footer) == fileSize;
+   std::vector<char> index(valid ? footer.indexSize : 0);
+   valid = valid && readAt(fileDescriptor, index.data(), index.size(), footer.indexOffset);
+
+   const char* cursor = index.data();
+   const char* end    = cursor + index.size();
+   auto        take   = [&cursor, end](void* value, const size_t size)
+   {
+      if (static_cast<size_t>(end - cursor) < size)
+         return false;
+      std::memcpy(value, cursor, size);
+      cursor += size;
+      return true;
+   };
+
+   for (uint32_t i = 0; valid && i < footer.animationCount; i++)
+   {
+      AnimationEntry animation;
+      uint32_t       nameLength = 0;
+      uint32_t       frameCount = 0;
+      valid = take(&nameLength, sizeof(nameLength)) && static_cast<size_t>(end - cursor) >= nameLength;
+      if (valid)
+      {
+         animation.name.assign(cursor, nameLength);
+         cursor += nameLength;
+         valid = take(&frameCount, sizeof(frameCount)) &&
+                 static_cast<size_t>(end - cursor) / sizeof(FrameEntry) >= frameCount;
+      }
+      if (valid)
+      {
+         animation.frames.resize(frameCount);
+         take(animation.frames.data(), frameCount * sizeof(FrameEntry));
+      }
+      for (const FrameEntry& frame : animation.frames)
+      {
+         valid = valid && frame.storedSize <= frame.size &&
+                 frame.offset + frame.storedSize <= footer.indexOffset;
+      }
+      m_animations.push_back(std::move(animation));
+   }
+
+   if (!valid || cursor != end)
+   {
+      std::cerr << "Invalid animation archive: " << fileLocation << std::endl;
+      ::close(fileDescriptor);
+      m_animations.clear();
+      return false;
+   }
+
+   m_fileDescriptor = fileDescriptor;
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationArchive::close()
+{
+   if (m_fileDescriptor >= 0)
+   {
+      ::close(m_fileDescriptor);
+   }
+   m_fileDescriptor = -1;
+   m_animations.clear();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationArchive::isOpen() const
+{
+   return m_fileDescriptor >= 0;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<AnimationArchive::AnimationEntry>& AnimationArchive::getAnimations() const
+{
+   return m_animations;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const AnimationArchive::AnimationEntry* AnimationArchive::findAnimation(const std::string& name) const
+{
+   for (const AnimationEntry& animation : m_animations)
+   {
+      if (animation.name == name)
+         return &animation;
+   }
+   return nullptr;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationArchive::readFrame(const FrameEntry& entry, std::string& text) const
+{
+   if (m_fileDescriptor < 0)
+      return false;
+
+   // A frame that did not shrink is stored as is
+   if (entry.storedSize == entry.size)
+   {
+      text.resize(entry.size);
+      return readAt(m_fileDescriptor, text.data(), entry.size, entry.offset);
+   }
+
+   std::string stored(entry.storedSize, '\0');
+   if (!readAt(m_fileDescriptor, stored.data(), stored.size(), entry.offset))
+      return false;
+   text.resize(entry.size);
+   return decompress(stored.data(), stored.size(), text);
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationArchive::write(const std::string fileLocation, const std::vector<AnimationText>& animations,
+                             const bool compress)
+{
+   // Every frame is compressed into its own slot, frames are numbered across all animations
+   std::vector<std::pair<size_t, size_t>> slots; // Animation index, frame index
+   for (size_t i = 0; i < animations.size(); i++)
+   {
+      for (size_t j = 0; j < animations[i].frames.size(); j++)
+      {
+         slots.emplace_back(i, j);
+      }
+   }
+   std::vector<std::string> compressed(compress ? slots.size() : 0);
+   if (compress)
+   {
+      ThreadPool::getLoaderPool().parallelFor(
+            slots.size(),
+            [&](size_t i)
+            {
+               const std::string& text = animations[slots[i].first].frames[slots[i].second].text;
+               AnimationArchive::compress(text.data(), text.size(), compressed[i]);
+            });
+   }
+
+   std::string   temporaryLocation = fileLocation + ".tmp";
+   std::ofstream out(temporaryLocation, std::ios::binary | std::ios::trunc);
+   if (!out.is_open())
+   {
+      std::cerr << "Failed to write animation archive: " << fileLocation << std::endl;
+      return false;
+   }
+
+   // Frames first, building the index as they go
+   std::string index;
+   uint64_t    offset = 0;
+   size_t      slot   = 0;
+   for (const AnimationText& animation : animations)
+   {
+      uint32_t nameLength = static_cast<uint32_t>(animation.name.size());
+      uint32_t frameCount = static_cast<uint32_t>(animation.frames.size());
+      index.append(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+      index.append(animation.name);
+      index.append(reinterpret_cast<const char*>(&frameCount), sizeof(frameCount));
+      for (const FrameText& frame : animation.frames)
+      {
+         const std::string& stored =
+               compress && compressed[slot].size() < frame.text.size() ? compressed[slot] : frame.text;
+         slot++;
+
+         FrameEntry entry;
+         entry.offset     = offset;
+         entry.storedSize = static_cast<uint32_t>(stored.size());
+         entry.size       = static_cast<uint32_t>(frame.text.size());
+         entry.duration   = frame.duration;
+         entry.layer      = frame.layer;
+         index.append(reinterpret_cast<const char*>(&entry), sizeof(entry));
+         out.write(stored.data(), stored.size());
+         offset += stored.size();
+      }
+   }
+
+   Footer footer;
+   footer.indexOffset    = offset;
+   footer.indexSize      = static_cast<uint32_t>(index.size());
+   footer.animationCount = static_cast<uint32_t>(animations.size());
+   std::memcpy(footer.magic, ANIMATION_ARCHIVE_MAGIC, sizeof(ANIMATION_ARCHIVE_MAGIC));
+   footer.version = VERSION;
+   out.write(index.data(), index.size());
+   out.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+   out.close();
+
+   if (!out || std::rename(temporaryLocation.c_str(), fileLocation.c_str()) != 0)
+   {
+      std::cerr << "Failed to write animation archive: " << fileLocation << std::endl;
+      std::remove(temporaryLocation.c_str());
+      return false;
+   }
+   return true;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+void AnimationArchive::compress(const char* data, const size_t size, std::string& compressed)
+{
+   compressed.clear();
+   compressed.reserve(size / 2 + 16);
+
+   // Most recent position of every hashed 4 byte sequence, size means none
+   std::vector<size_t> recent(size_t(1) << LZ_HASH_BITS, size);
+   size_t              anchor   = 0;
+   size_t              position = 0;
+   while (position + LZ_MIN_MATCH <= size)
+   {
+      uint32_t sequence;
+      std::memcpy(&sequence, data + position, sizeof(sequence));
+      uint32_t hash      = (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+      size_t   candidate = recent[hash];
+      recent[hash]       = position;
+
+      if (candidate == size || position - candidate > LZ_MAX_OFFSET ||
+          std::memcmp(data + candidate, data + position, LZ_MIN_MATCH) != 0)
+      {
+         position++;
+         continue;
+      }
+
+      size_t matchLength = LZ_MIN_MATCH;
+      while (position + matchLength < size && data[candidate + matchLength] == data[position + matchLength])
+         matchLength++;
+
+      appendSequence(compressed, data + anchor, position - anchor, position - candidate, matchLength);
+      position += matchLength;
+      anchor = position;
+   }
+   appendSequence(compressed, data + anchor, size - anchor, 0, 0);
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationArchive::decompress(const char* data, const size_t size, std::string& decompressed)
+{
+   const unsigned char* cursor  = reinterpret_cast<const unsigned char*>(data);
+   const unsigned char* end     = cursor + size;
+   size_t               written = 0;
+   while (cursor < end)
+   {
+      unsigned char token        = *cursor++;
+      size_t        literalCount = token >> 4;
+      if (literalCount == 15 && !readLength(cursor, end, literalCount))
+         return false;
+      if (literalCount > static_cast<size_t>(end - cursor) || literalCount > decompressed.size() - written)
+         return false;
+      std::memcpy(&decompressed[written], cursor, literalCount);
+      cursor += literalCount;
+      written += literalCount;
+
+      if (cursor == end)
+         break;
+
+      if (end - cursor < 2)
+         return false;
+      size_t offset = cursor[0] | (static_cast<size_t>(cursor[1]) << 8);
+      cursor += 2;
+      size_t matchLength = token & 0x0F;
+      if (matchLength == 15 && !readLength(cursor, end, matchLength))
+         return false;
+      matchLength += LZ_MIN_MATCH;
+      if (offset == 0 || offset > written || matchLength > decompressed.size() - written)
+         return false;
+
+      // Byte by byte, a match may overlap the bytes it is still producing
+      for (size_t i = 0; i < matchLength; i++)
+      {
+         decompressed[written + i] = decompressed[written - offset + i];
+      }
+      written += matchLength;
+   }
+   return written == decompressed.size();
+};
@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationFile.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationFile for reading and writing compiled animations
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/AnimationFile.h"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+static_assert(sizeof(AnimationFile::Header) == 16, "AnimationFile::Header must be packed");
+static_assert(sizeof(AnimationFile::FrameEntry) == 16, "AnimationFile::FrameEntry must be packed");
+static_assert(sizeof(AnimationFile::Cell) == 28, "AnimationFile::Cell must be packed");
+
+static const char ANIMATION_FILE_MAGIC[4] = {'L', 'A', 'E', 'A'};
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationFile::AnimationFile()
+{
+   m_mapping     = nullptr;
+   m_mappingSize = 0;
+   m_header      = nullptr;
+   m_frameTable  = nullptr;
+   m_cells       = nullptr;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationFile::AnimationFile(const std::string fileLocation) : AnimationFile()
+{
+   open(fileLocation);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+AnimationFile::~AnimationFile()
+{
+   close();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationFile::open(const std::string fileLocation)
+{
+   close();
+
+   int fileDescriptor = ::open(fileLocation.c_str(), O_RDONLY);
+   if (fileDescriptor < 0)
+      return false;
+
+   struct stat fileStats;
+   if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size < (off_t)sizeof(Header))
+   {
+      ::close(fileDescriptor);
+      std::cerr << "Invalid animation file: " << fileLocation << std::endl;
+      return false;
+   }
+
+   size_t size    = static_cast<size_t>(fileStats.st_size);
+   void*  mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+   ::close(fileDescriptor); // The mapping stays valid after the descriptor is closed
+   if (mapping == MAP_FAILED)
+   {
+      std::cerr << "Failed to map animation file: " << fileLocation << std::endl;
+      return false;
+   }
+
+   m_mapping     = mapping;
+   m_mappingSize = size;
+
+   // Check the header and that both tables fit exactly in the file before handing out any pointers
+   const Header* header     = static_cast<const Header*>(m_mapping);
+   uint64_t      frameBytes = static_cast<uint64_t>(header->frameCount) * sizeof(FrameEntry);
+   uint64_t      cellBytes  = static_cast<uint64_t>(header->cellCount) * sizeof(Cell);
+   if (std::memcmp(header->magic, ANIMATION_FILE_MAGIC, sizeof(ANIMATION_FILE_MAGIC)) != 0 ||
+       header->version != VERSION || sizeof(Header) + frameBytes + cellBytes != size)
+   {
+      std::cerr << "Invalid animation file: " << fileLocation << std::endl;
+      close();
+      return false;
+   }
+
+   const char* base = static_cast<const char*>(m_mapping);
+   m_header         = header;
+   m_frameTable     = reinterpret_cast<const FrameEntry*>(base + sizeof(Header));
+   m_cells          = reinterpret_cast<const Cell*>(base + sizeof(Header) + frameBytes);
+
+   for (size_t i = 0; i < header->frameCount; i++)
+   {
+      if (static_cast<uint64_t>(m_frameTable[i].firstCell) + m_frameTable[i].cellCount > header->cellCount)
+      {
+         std::cerr << "Invalid animation file: " << fileLocation << std::endl;
+         close();
+         return false;
+      }
+   }
+
+   // Frames are read front to back when an animation loads
+   madvise(m_mapping, m_mappingSize, MADV_SEQUENTIAL);
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationFile::close()
+{
+   if (m_mapping != nullptr)
+   {
+      munmap(m_mapping, m_mappingSize);
+   }
+   m_mapping     = nullptr;
+   m_mappingSize = 0;
+   m_header      = nullptr;
+   m_frameTable  = nullptr;
+   m_cells       = nullptr;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationFile::isOpen() const
+{
+   return m_header != nullptr;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t AnimationFile::getFrameCount() const
+{
+   if (m_header == nullptr)
+      return 0;
+
+   return m_header->frameCount;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const AnimationFile::FrameEntry& AnimationFile::getFrameEntry(const size_t index) const
+{
+   return m_frameTable[index];
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const AnimationFile::Cell* AnimationFile::getCells(const size_t index) const
+{
+   return m_cells + m_frameTable[index].firstCell;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+Frame AnimationFile::getFrame(const size_t index) const
+{
+   const FrameEntry& entry = m_frameTable[index];
+   const Cell*       cells = getCells(index);
+
+   std::vector<Pixel> pixels;
+   pixels.reserve(entry.cellCount);
+   for (uint32_t i = 0; i < entry.cellCount; i++)
+   {
+      const Cell& cell = cells[i];
+      pixels.emplace_back(Position(cell.x, cell.y), static_cast<wchar_t>(cell.character),
+                          RGB(cell.textR, cell.textG, cell.textB),
+                          RGB(cell.backgroundR, cell.backgroundG, cell.backgroundB),
+                          static_cast<attr_t>(cell.attributes));
+   }
+   return Frame(Sprite(std::move(pixels), entry.layer), entry.duration);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationFile::releaseFrame(const size_t index) const
+{
+   const char* base  = static_cast<const char*>(m_mapping);
+   size_t      begin = reinterpret_cast<const char*>(getCells(index)) - base;
+   size_t      end   = begin + m_frameTable[index].cellCount * sizeof(Cell);
+
+   // Only whole pages inside the frame, the pages at either edge are shared with the neighbouring frames
+   size_t pageSize  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+   size_t firstPage = (begin + pageSize - 1) / pageSize * pageSize;
+   size_t lastPage  = end / pageSize * pageSize;
+   if (firstPage < lastPage)
+   {
+      madvise(const_cast<char*>(base) + firstPage, lastPage - firstPage, MADV_DONTNEED);
+   }
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationFile::write(const std::string fileLocation, const std::vector<Frame>& frames)
+{
+   Header header;
+   std::memcpy(header.magic, ANIMATION_FILE_MAGIC, sizeof(ANIMATION_FILE_MAGIC));
+   header.version    = VERSION;
+   header.frameCount = static_cast<uint32_t>(frames.size());
+   header.cellCount  = 0;
+
+   std::vector<FrameEntry> frameTable;
+   std::vector<Cell>       cells;
+   frameTable.reserve(frames.size());
+   for (const Frame& frame : frames)
+   {
+      if (!frame.isKeyframe())
+      {
+         std::cerr << "Cannot compile delta encoded frames to: " << fileLocation << std::endl;
+         return false;
+      }
+
+      const Sprite& sprite = frame.getSprite();
+      FrameEntry    entry;
+      entry.duration  = frame.getDuration();
+      entry.layer     = sprite.getLayer();
+      entry.firstCell = static_cast<uint32_t>(cells.size());
+      entry.cellCount = static_cast<uint32_t>(sprite.getPixels().size());
+      frameTable.push_back(entry);
+
+      for (const Pixel& pixel : sprite.getPixels())
+      {
+         Cell cell;
+         cell.x           = pixel.getPosition().getX();
+         cell.y           = pixel.getPosition().getY();
+         cell.character   = static_cast<uint32_t>(pixel.getCharacter());
+         cell.textR       = static_cast<int16_t>(pixel.getTextColor().getR());
+         cell.textG       = static_cast<int16_t>(pixel.getTextColor().getG());
+         cell.textB       = static_cast<int16_t>(pixel.getTextColor().getB());
+         cell.backgroundR = static_cast<int16_t>(pixel.getBackgroundColor().getR());
+         cell.backgroundG = static_cast<int16_t>(pixel.getBackgroundColor().getG());
+         cell.backgroundB = static_cast<int16_t>(pixel.getBackgroundColor().getB());
+         cell.attributes  = static_cast<uint32_t>(pixel.getAttributes());
+         cells.push_back(cell);
+      }
+   }
+   header.cellCount = static_cast<uint32_t>(cells.size());
+
+   std::string   temporaryLocation = fileLocation + ".tmp";
+   std::ofstream out(temporaryLocation, std::ios::binary | std::ios::trunc);
+   if (!out.is_open())
+   {
+      std::cerr << "Failed to write animation file: " << fileLocation << std::endl;
+      return false;
+   }
+   out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+   out.write(reinterpret_cast<const char*>(frameTable.data()), frameTable.size() * sizeof(FrameEntry));
+   out.write(reinterpret_cast<const char*>(cells.data()), cells.size() * sizeof(Cell));
+   out.close();
+
+   if (!out || std::rename(temporaryLocation.c_str(), fileLocation.c_str()) != 0)
+   {
+      std::cerr << "Failed to write animation file: " << fileLocation << std::endl;
+      std::remove(temporaryLocation.c_str());
+      return false;
+   }
+   return true;
+};
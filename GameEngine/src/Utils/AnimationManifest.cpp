@@ -0,0 +1,234 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationManifest.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationManifest for reading and writing animation manifests
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/AnimationManifest.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+static const int MANIFEST_NUMERIC_FIELDS = 7;
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseField(const std::string_view field, int& value)
+{
+   return std::from_chars(field.data(), field.data() + field.size(), value).ec == std::errc();
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseField(const std::string_view field, float& value)
+{
+   return std::from_chars(field.data(), field.data() + field.size(), value).ec == std::errc();
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseField(const std::string_view field, uint64_t& value)
+{
+   return std::from_chars(field.data(), field.data() + field.size(), value, 16).ec == std::errc();
+}
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationManifest::read(const std::string fileLocation)
+{
+   m_frames.clear();
+
+   std::ifstream in(fileLocation);
+   if (!in.is_open())
+      return false;
+
+   // Header: manifest,version,frame count
+   std::string line;
+   int         version    = 0;
+   int         frameCount = 0;
+   if (!std::getline(in, line) || line.compare(0, 9, "manifest,") != 0)
+   {
+      std::cerr << "Invalid animation manifest: " << fileLocation << std::endl;
+      return false;
+   }
+   std::string_view header(line);
+   header.remove_prefix(9);
+   size_t comma = header.find(',');
+   if (comma == std::string_view::npos || !parseField(header.substr(0, comma), version) ||
+       !parseField(header.substr(comma + 1), frameCount) || version != VERSION || frameCount < 0)
+   {
+      std::cerr << "Invalid animation manifest: " << fileLocation << std::endl;
+      return false;
+   }
+
+   m_frames.reserve(frameCount);
+   while (static_cast<int>(m_frames.size()) < frameCount && std::getline(in, line))
+   {
+      // The numeric fields are split off the end so a file name may hold commas
+      std::string_view fields[MANIFEST_NUMERIC_FIELDS];
+      std::string_view rest(line);
+      bool             valid = true;
+      for (int i = MANIFEST_NUMERIC_FIELDS - 1; i >= 0 && valid; i--)
+      {
+         size_t split = rest.rfind(',');
+         valid        = split != std::string_view::npos;
+         if (valid)
+         {
+            fields[i] = rest.substr(split + 1);
+            rest      = rest.substr(0, split);
+         }
+      }
+
+      FrameInfo info;
+      int       minX = 0, minY = 0, maxX = 0, maxY = 0;
+      info.fileName = std::string(rest);
+      valid = valid && !info.fileName.empty() && parseField(fields[0], info.duration) &&
+              parseField(fields[1], info.layer) && parseField(fields[2], minX) &&
+              parseField(fields[3], minY) && parseField(fields[4], maxX) && parseField(fields[5], maxY) &&
+              parseField(fields[6], info.hash);
+      if (!valid)
+      {
+         std::cerr << "Invalid animation manifest: " << fileLocation << std::endl;
+         m_frames.clear();
+         return false;
+      }
+      info.minPosition = Position(minX, minY);
+      info.maxPosition = Position(maxX, maxY);
+      m_frames.push_back(info);
+   }
+
+   if (static_cast<int>(m_frames.size()) != frameCount)
+   {
+      std::cerr << "Invalid animation manifest: " << fileLocation << std::endl;
+      m_frames.clear();
+      return false;
+   }
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool AnimationManifest::write(const std::string fileLocation) const
+{
+   std::string   temporaryLocation = fileLocation + ".tmp";
+   std::ofstream out(temporaryLocation, std::ios::trunc);
+   if (!out.is_open())
+   {
+      std::cerr << "Failed to write animation manifest: " << fileLocation << std::endl;
+      return false;
+   }
+
+   out << "manifest," << VERSION << "," << m_frames.size() << "\n";
+   char hashText[17];
+   for (const FrameInfo& info : m_frames)
+   {
+      std::snprintf(hashText, sizeof(hashText), "%016llx", static_cast<unsigned long long>(info.hash));
+      out << info.fileName << "," << info.duration << "," << info.layer << ","
+          << info.minPosition.getX() << "," << info.minPosition.getY() << "," << info.maxPosition.getX()
+          << "," << info.maxPosition.getY() << "," << hashText << "\n";
+   }
+   out.close();
+
+   if (!out || std::rename(temporaryLocation.c_str(), fileLocation.c_str()) != 0)
+   {
+      std::cerr << "Failed to write animation manifest: " << fileLocation << std::endl;
+      std::remove(temporaryLocation.c_str());
+      return false;
+   }
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void AnimationManifest::addFrame(const FrameInfo& info)
+{
+   m_frames.push_back(info);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+const std::vector<AnimationManifest::FrameInfo>& AnimationManifest::getFrames() const
+{
+   return m_frames;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t AnimationManifest::getFrameCount() const
+{
+   return m_frames.size();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+float AnimationManifest::getTotalDuration() const
+{
+   float total = 0.0f;
+   for (const FrameInfo& info : m_frames)
+   {
+      total += info.duration;
+   }
+   return total;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+AnimationManifest::FrameInfo AnimationManifest::describeFrame(const std::string fileName, const Frame& frame,
+                                                              const uint64_t hash)
+{
+   FrameInfo info;
+   info.fileName = fileName;
+   info.duration = frame.getDuration();
+   info.layer    = frame.getSprite().getLayer();
+   info.hash     = hash;
+
+   const std::vector<Pixel>& pixels = frame.getSprite().getPixels();
+   if (pixels.empty())
+   {
+      info.minPosition = Position(0, 0);
+      info.maxPosition = Position(-1, -1);
+   }
+   else
+   {
+      int minX = pixels.front().getPosition().getX(), maxX = minX;
+      int minY = pixels.front().getPosition().getY(), maxY = minY;
+      for (const Pixel& pixel : pixels)
+      {
+         minX = std::min(minX, pixel.getPosition().getX());
+         minY = std::min(minY, pixel.getPosition().getY());
+         maxX = std::max(maxX, pixel.getPosition().getX());
+         maxY = std::max(maxY, pixel.getPosition().getY());
+      }
+      info.minPosition = Position(minX, minY);
+      info.maxPosition = Position(maxX, maxY);
+   }
+   return info;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+uint64_t AnimationManifest::hash(const char* data, const size_t size)
+{
+   uint64_t value = 0xcbf29ce484222325ULL;
+   for (size_t i = 0; i < size; i++)
+   {
+      value ^= static_cast<unsigned char>(data[i]);
+      value *= 0x100000001b3ULL;
+   }
+   return value;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationManifest::hashFile(const std::string fileLocation, uint64_t& fileHash)
+{
+   std::ifstream in(fileLocation, std::ios::binary | std::ios::ate);
+   if (!in.is_open())
+      return false;
+
+   std::streamoff    fileSize = in.tellg();
+   std::vector<char> buffer(fileSize > 0 ? static_cast<size_t>(fileSize) : 0);
+   in.seekg(0);
+   in.read(buffer.data(), buffer.size());
+   if (!in)
+      return false;
+
+   fileHash = hash(buffer.data(), buffer.size());
+   return true;
+};
@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationSheet.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationSheet for reading and writing multi frame text files
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/AnimationSheet.h"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseSheetHeader(const std::string_view line, size_t& frameCount)
+{
+   // sheet,version,frame count
+   if (line.compare(0, 6, "sheet,") != 0)
+      return false;
+
+   std::string_view fields  = line.substr(6);
+   size_t           comma   = fields.find(',');
+   int              version = 0;
+   if (comma == std::string_view::npos ||
+       std::from_chars(fields.data(), fields.data() + comma, version).ec != std::errc() ||
+       version != AnimationSheet::VERSION)
+      return false;
+
+   const char* countStart = fields.data() + comma + 1;
+   return std::from_chars(countStart, fields.data() + fields.size(), frameCount).ec == std::errc();
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseRecordLine(const std::string_view line, size_t& size)
+{
+   // frame,byte count
+   if (line.compare(0, 6, "frame,") != 0)
+      return false;
+
+   return std::from_chars(line.data() + 6, line.data() + line.size(), size).ec == std::errc();
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationSheet::read(const std::string fileLocation, std::vector<char>& buffer,
+                          std::vector<std::string_view>& frames)
+{
+   frames.clear();
+
+   std::ifstream in(fileLocation, std::ios::binary | std::ios::ate);
+   if (!in.is_open())
+      return false;
+
+   std::streamoff fileSize = in.tellg();
+   buffer.resize(fileSize > 0 ? static_cast<size_t>(fileSize) : 0);
+   in.seekg(0);
+   in.read(buffer.data(), buffer.size());
+   if (!in)
+   {
+      std::cerr << "Failed to read animation sheet: " << fileLocation << std::endl;
+      return false;
+   }
+
+   const char* cursor = buffer.data();
+   const char* end    = cursor + buffer.size();
+
+   // Splits off the next line, cursor moves past its newline
+   auto nextLine = [&cursor, end](std::string_view& line)
+   {
+      if (cursor >= end)
+         return false;
+      const char* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+      if (lineEnd == nullptr)
+         lineEnd = end;
+      line   = std::string_view(cursor, lineEnd - cursor);
+      cursor = lineEnd < end ? lineEnd + 1 : end;
+      return true;
+   };
+
+   std::string_view line;
+   size_t           frameCount = 0;
+   if (!nextLine(line) || !parseSheetHeader(line, frameCount))
+   {
+      std::cerr << "Invalid animation sheet: " << fileLocation << std::endl;
+      return false;
+   }
+
+   frames.reserve(frameCount);
+   for (size_t i = 0; i < frameCount; i++)
+   {
+      size_t size = 0;
+      if (!nextLine(line) || !parseRecordLine(line, size) || size > static_cast<size_t>(end - cursor))
+      {
+         std::cerr << "Invalid animation sheet: " << fileLocation << std::endl;
+         frames.clear();
+         return false;
+      }
+      frames.emplace_back(cursor, size);
+      cursor += size;
+   }
+   return true;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationSheet::readIndex(const std::string fileLocation, std::vector<Record>& records)
+{
+   records.clear();
+
+   std::ifstream in(fileLocation, std::ios::binary | std::ios::ate);
+   if (!in.is_open())
+      return false;
+   uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+   in.seekg(0);
+
+   std::string line;
+   size_t      frameCount = 0;
+   if (!std::getline(in, line) || !parseSheetHeader(line, frameCount))
+   {
+      std::cerr << "Invalid animation sheet: " << fileLocation << std::endl;
+      return false;
+   }
+
+   records.reserve(frameCount);
+   for (size_t i = 0; i < frameCount; i++)
+   {
+      Record record;
+      record.size = 0;
+      if (!std::getline(in, line) || !parseRecordLine(line, record.size))
+         break;
+
+      record.offset = static_cast<uint64_t>(in.tellg());
+      if (record.offset + record.size > fileSize)
+         break;
+      if (record.size > 0)
+      {
+         std::getline(in, record.headerLine);
+      }
+      in.clear();
+      in.seekg(static_cast<std::streamoff>(record.offset + record.size));
+      records.push_back(std::move(record));
+   }
+
+   if (records.size() != frameCount)
+   {
+      std::cerr << "Invalid animation sheet: " << fileLocation << std::endl;
+      records.clear();
+      return false;
+   }
+   return true;
+};
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationSheet::write(const std::string fileLocation, const std::vector<std::string>& frames)
+{
+   std::string   temporaryLocation = fileLocation + ".tmp";
+   std::ofstream out(temporaryLocation, std::ios::binary | std::ios::trunc);
+   if (!out.is_open())
+   {
+      std::cerr << "Failed to write animation sheet: " << fileLocation << std::endl;
+      return false;
+   }
+
+   out << "sheet," << VERSION << "," << frames.size() << "\n";
+   for (const std::string& frame : frames)
+   {
+      out << "frame," << frame.size() << "\n";
+      out.write(frame.data(), frame.size());
+   }
+   out.close();
+
+   if (!out || std::rename(temporaryLocation.c_str(), fileLocation.c_str()) != 0)
+   {
+      std::cerr << "Failed to write animation sheet: " << fileLocation << std::endl;
+      std::remove(temporaryLocation.c_str());
+      return false;
+   }
+   return true;
+};
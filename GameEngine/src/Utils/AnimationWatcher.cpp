@@ -0,0 +1,450 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationWatcher.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of AnimationWatcher for reloading animations edited on disk
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/AnimationWatcher.h"
+#include "../../include/AnimationFile.h"
+#include "../../include/AnimationManifest.h"
+#include "../../include/AnimationSheet.h"
+#include "../../include/Parameters.h"
+#include "../../include/PrintableFactory.h"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static const std::string WATCH_ROOT          = "src/Animations";
+static const int         SETTLE_MILLISECONDS = 15;
+static const uint32_t    WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
+
+// Depth of an animation directory below WATCH_ROOT, entity/animation
+static const int ANIMATION_DEPTH = 2;
+
+struct PendingChange
+{
+   std::set<std::string> fileNames;              // Text frame files written in place or renamed over
+   bool                  wholeAnimation = false; // Frames added or removed, or the sheet changed
+};
+
+struct Reload
+{
+   std::string         entityName;
+   std::string         animationName;
+   size_t              frameCount;   // Text frames in the directory when it was read
+   std::vector<size_t> frameIndices; // Index of each reloaded frame, empty when the whole animation reloaded
+   std::vector<Frame>  frames;
+};
+
+// Watcher thread state, only touched by the watcher thread while it runs
+static std::thread                          watcherThread;
+static int                                  inotifyDescriptor = -1;
+static int                                  wakeDescriptor    = -1; // Written by stop and requestReload
+static std::atomic<bool>                    stopRequested(false);
+static std::unordered_map<int, std::string> watchedDirectories; // Watch descriptor to path below WATCH_ROOT
+
+// Window of each displayed printable, so a reload can mark the window for re-sorting
+using WindowPrintable = std::pair<NcursesWindow*, std::shared_ptr<Printable>>;
+
+// Reloads parsed by the watcher thread, waiting for applyReloads on the main thread
+static std::mutex          readyMutex;
+static std::vector<Reload> readyReloads;
+static std::atomic<bool>   reloadsReady(false);
+
+// Animation directories applyReloads found out of step with a partial reload, guarded by readyMutex. The
+// watcher thread loads them whole.
+static std::set<std::string> requestedReloads;
+
+// private static --------------------------------------------------------------------------------------------
+static int directoryDepth(const std::string& relativePath)
+{
+   if (relativePath.empty())
+      return 0;
+
+   int depth = 1;
+   for (char character : relativePath)
+   {
+      depth += character == '/';
+   }
+   return depth;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void watchDirectory(const std::string& relativePath, std::vector<std::string>& animationDirectories)
+{
+   std::string path       = relativePath.empty() ? WATCH_ROOT : WATCH_ROOT + "/" + relativePath;
+   int         descriptor = inotify_add_watch(inotifyDescriptor, path.c_str(), WATCH_MASK | IN_ONLYDIR);
+   if (descriptor < 0)
+      return;
+   watchedDirectories[descriptor] = relativePath;
+
+   int depth = directoryDepth(relativePath);
+   if (depth == ANIMATION_DEPTH)
+   {
+      animationDirectories.push_back(relativePath);
+      return;
+   }
+
+   // A directory made in between is still reported by its own create event once watched
+   std::error_code error;
+   for (const auto& entry : fs::directory_iterator(path, error))
+   {
+      if (entry.is_directory(error))
+      {
+         std::string name = entry.path().filename().string();
+         watchDirectory(relativePath.empty() ? name : relativePath + "/" + name, animationDirectories);
+      }
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool isTextFrameName(const std::string& fileName)
+{
+   // Same rule as the loader: everything but the compiled file, manifest and sheet, and no temporary files
+   bool temporary = fileName.size() >= 4 && fileName.compare(fileName.size() - 4, 4, ".tmp") == 0;
+   return !temporary && fileName != AnimationFile::FILE_NAME && fileName != AnimationManifest::FILE_NAME &&
+          fileName != AnimationSheet::FILE_NAME;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void recordEvent(const inotify_event& event, std::map<std::string, PendingChange>& pending)
+{
+   auto watched = watchedDirectories.find(event.wd);
+   if (watched == watchedDirectories.end())
+      return;
+   if (event.mask & IN_IGNORED)
+   {
+      watchedDirectories.erase(watched);
+      return;
+   }
+
+   const std::string directory = watched->second;
+   const std::string name      = event.len > 0 ? std::string(event.name) : std::string();
+   const int         depth     = directoryDepth(directory);
+
+   if (event.mask & IN_ISDIR)
+   {
+      // New entity or animation directories get watched, their animations load whole
+      if ((event.mask & (IN_CREATE | IN_MOVED_TO)) && depth < ANIMATION_DEPTH)
+      {
+         std::vector<std::string> animationDirectories;
+         watchDirectory(directory.empty() ? name : directory + "/" + name, animationDirectories);
+         for (const std::string& animationDirectory : animationDirectories)
+         {
+            pending[animationDirectory].wholeAnimation = true;
+         }
+      }
+      return;
+   }
+
+   if (depth != ANIMATION_DEPTH)
+      return;
+
+   if (name == AnimationSheet::FILE_NAME)
+   {
+      pending[directory].wholeAnimation = true;
+   }
+   else if (isTextFrameName(name))
+   {
+      PendingChange& change = pending[directory];
+      if (event.mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM))
+         change.wholeAnimation = true;
+      else
+         change.fileNames.insert(name);
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void readEvents(std::map<std::string, PendingChange>& pending)
+{
+   alignas(inotify_event) char buffer[16 * 1024];
+   while (true)
+   {
+      ssize_t length = read(inotifyDescriptor, buffer, sizeof(buffer));
+      if (length <= 0)
+         return;
+
+      for (ssize_t offset = 0; offset < length;)
+      {
+         const inotify_event& event = *reinterpret_cast<const inotify_event*>(buffer + offset);
+         offset += sizeof(inotify_event) + event.len;
+
+         // Events were dropped, every animation may have changed
+         if (event.mask & IN_Q_OVERFLOW)
+         {
+            for (const auto& watched : watchedDirectories)
+            {
+               if (directoryDepth(watched.second) == ANIMATION_DEPTH)
+                  pending[watched.second].wholeAnimation = true;
+            }
+            continue;
+         }
+         recordEvent(event, pending);
+      }
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void parseChanges(const std::map<std::string, PendingChange>& pending)
+{
+   std::vector<Reload> reloads;
+   for (const auto& [directory, change] : pending)
+   {
+      std::string     folderPath = WATCH_ROOT + "/" + directory;
+      size_t          split      = directory.find('/');
+      std::error_code error;
+      if (!fs::is_directory(folderPath, error))
+         continue;
+
+      Reload reload;
+      reload.entityName    = directory.substr(0, split);
+      reload.animationName = directory.substr(split + 1);
+
+      if (change.wholeAnimation || fs::exists(folderPath + "/" + AnimationSheet::FILE_NAME, error))
+      {
+         Animation animation = PrintableFactory::loadAnimation(reload.entityName, reload.animationName, true);
+         reload.frames       = animation.getFrames();
+         reload.frameCount   = reload.frames.size();
+      }
+      else
+      {
+         std::vector<std::string> fileNames(change.fileNames.begin(), change.fileNames.end());
+         reload.frameCount =
+               PrintableFactory::reloadTextFrames(folderPath, fileNames, reload.frameIndices, reload.frames);
+      }
+
+      if (!reload.frames.empty())
+         reloads.push_back(std::move(reload));
+   }
+
+   if (reloads.empty())
+      return;
+
+   std::lock_guard<std::mutex> lock(readyMutex);
+   for (Reload& reload : reloads)
+   {
+      readyReloads.push_back(std::move(reload));
+   }
+   reloadsReady.store(true, std::memory_order_release);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void watchLoop()
+{
+   // Changes are collected until the directory has been quiet for SETTLE_MILLISECONDS, so a save that
+   // touches several files is parsed once
+   std::map<std::string, PendingChange> pending;
+   while (true)
+   {
+      pollfd descriptors[2] = {{inotifyDescriptor, POLLIN, 0}, {wakeDescriptor, POLLIN, 0}};
+      int    ready          = poll(descriptors, 2, pending.empty() ? -1 : SETTLE_MILLISECONDS);
+      if (ready < 0 && errno != EINTR)
+      {
+         std::cerr << "Animation watcher stopped: poll failed" << std::endl;
+         return;
+      }
+      if (descriptors[1].revents & POLLIN)
+      {
+         uint64_t wakes;
+         if (stopRequested.load(std::memory_order_acquire) ||
+             (read(wakeDescriptor, &wakes, sizeof(wakes)) < 0 && errno != EAGAIN))
+            return;
+
+         std::lock_guard<std::mutex> lock(readyMutex);
+         for (const std::string& directory : requestedReloads)
+         {
+            pending[directory].wholeAnimation = true;
+         }
+         requestedReloads.clear();
+      }
+
+      if (ready == 0)
+      {
+         parseChanges(pending);
+         pending.clear();
+      }
+      else if (descriptors[0].revents & POLLIN)
+      {
+         readEvents(pending);
+      }
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void collectPrintables(const std::vector<std::shared_ptr<NcursesWindow>>& windows,
+                              std::vector<WindowPrintable>&                      printables)
+{
+   for (const auto& window : windows)
+   {
+      if (!window)
+         continue;
+      for (const auto& printable : window->getPrintables())
+      {
+         printables.emplace_back(window.get(), printable);
+      }
+      collectPrintables(window->getSubWindows(), printables);
+   }
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationWatcher::start()
+{
+   if (watcherThread.joinable())
+      return true;
+
+   inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+   wakeDescriptor    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+   watchedDirectories.clear();
+
+   std::vector<std::string> animationDirectories;
+   if (inotifyDescriptor >= 0 && wakeDescriptor >= 0)
+      watchDirectory("", animationDirectories);
+
+   if (watchedDirectories.empty())
+   {
+      std::cerr << "Failed to watch " << WATCH_ROOT << " for animation changes" << std::endl;
+      stop();
+      return false;
+   }
+
+   stopRequested.store(false, std::memory_order_release);
+   watcherThread = std::thread(watchLoop);
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+void AnimationWatcher::stop()
+{
+   if (watcherThread.joinable())
+   {
+      // Other than EINTR the write only fails when the counter is already non-zero, poll wakes either way.
+      // Joined before the descriptors the thread polls are closed.
+      stopRequested.store(true, std::memory_order_release);
+      uint64_t wake = 1;
+      while (write(wakeDescriptor, &wake, sizeof(wake)) < 0 && errno == EINTR)
+      {
+      }
+      watcherThread.join();
+   }
+
+   if (inotifyDescriptor >= 0)
+      close(inotifyDescriptor);
+   if (wakeDescriptor >= 0)
+      close(wakeDescriptor);
+   inotifyDescriptor = -1;
+   wakeDescriptor    = -1;
+   watchedDirectories.clear();
+
+   std::lock_guard<std::mutex> lock(readyMutex);
+   readyReloads.clear();
+   requestedReloads.clear();
+   reloadsReady.store(false, std::memory_order_release);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool AnimationWatcher::isRunning()
+{
+   return watcherThread.joinable();
+}
+
+// public static ---------------------------------------------------------------------------------------------
+size_t AnimationWatcher::applyReloads()
+{
+   if (!reloadsReady.load(std::memory_order_acquire))
+      return 0;
+
+   std::vector<Reload> reloads;
+   {
+      std::lock_guard<std::mutex> lock(readyMutex);
+      reloads.swap(readyReloads);
+      reloadsReady.store(false, std::memory_order_release);
+   }
+
+   std::vector<WindowPrintable> printables;
+   collectPrintables(ncursesWindows, printables);
+
+   size_t                updated = 0;
+   std::set<std::string> outOfStep;
+   for (Reload& reload : reloads)
+   {
+      std::unordered_set<Printable*> visited;
+      for (auto& [window, printable] : printables)
+      {
+         if (printable->getPrintableName() != reload.entityName || !visited.insert(printable.get()).second)
+            continue;
+
+         for (Animation& animation : printable->getAnimationsMutable())
+         {
+            if (animation.getAnimationName() != reload.animationName || animation.getStream() != nullptr)
+               continue;
+
+            // Frames were added or removed since the live animation loaded, a partial reload cannot line up.
+            // The watcher thread loads it whole instead, the main thread never parses frames.
+            if (!reload.frameIndices.empty() && animation.getTotalFrames() != reload.frameCount)
+            {
+               outOfStep.insert(reload.entityName + "/" + reload.animationName);
+               continue;
+            }
+
+            // Only the cells of the replaced sprite are erased, the new one is drawn over them
+            if (printable->getCurrentAnimationName() == reload.animationName)
+               printable->addDirtySprite(animation.getCurrentFrameSprite());
+
+            if (reload.frameIndices.empty())
+            {
+               animation.replaceFrames(reload.frames);
+            }
+            else
+            {
+               for (size_t i = 0; i < reload.frameIndices.size(); i++)
+               {
+                  animation.replaceFrame(reload.frameIndices[i], reload.frames[i]);
+               }
+            }
+            window->setPrintablesNeedSorted(true);
+            updated++;
+         }
+      }
+   }
+
+   if (!outOfStep.empty())
+   {
+      {
+         std::lock_guard<std::mutex> lock(readyMutex);
+         requestedReloads.insert(outOfStep.begin(), outOfStep.end());
+      }
+      uint64_t wake = 1;
+      while (write(wakeDescriptor, &wake, sizeof(wake)) < 0 && errno == EINTR)
+      {
+      }
+   }
+
+   // Reloaded art can change the shape of a button, locked UI is laid out again with the new sizes
+   if (updated > 0)
+   {
+      uiLayoutVersion++;
+      UIElement::updateAllLockedPositions();
+   }
+   return updated;
+}
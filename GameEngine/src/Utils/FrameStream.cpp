@@ -0,0 +1,189 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file FrameStream.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of FrameStream for streaming animation frames from disk
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/FrameStream.h"
+#include <utility>
+
+// public ----------------------------------------------------------------------------------------------------
+FrameStream::FrameStream(const size_t frameCount, ReadFrame readFrame, const size_t memoryCap)
+{
+   m_readFrame     = std::move(readFrame);
+   m_readMutex     = std::make_shared<std::mutex>();
+   m_frameCount    = frameCount;
+   m_windowStart   = 0;
+   m_nextRead      = 0;
+   m_generation    = 0;
+   m_bufferedBytes = 0;
+   m_memoryCap     = memoryCap;
+   m_underrunCount = 0;
+   m_stopping      = false;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+FrameStream::~FrameStream()
+{
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+   }
+   m_spaceAvailable.notify_all();
+   if (m_prefetcher.joinable())
+   {
+      m_prefetcher.join();
+   }
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void FrameStream::prefetchLoop()
+{
+   std::unique_lock<std::mutex> lock(m_mutex);
+   while (!m_stopping)
+   {
+      bool full = m_window.size() >= m_frameCount || (!m_window.empty() && m_bufferedBytes >= m_memoryCap);
+      if (full)
+      {
+         m_spaceAvailable.wait(lock);
+         continue;
+      }
+
+      // Read without the lock so playback is never held up by the disk
+      uint64_t sequence   = m_nextRead;
+      uint64_t generation = m_generation;
+      lock.unlock();
+      Frame frame;
+      {
+         std::lock_guard<std::mutex> readLock(*m_readMutex);
+         frame = m_readFrame(static_cast<size_t>(sequence % m_frameCount));
+      }
+      lock.lock();
+
+      // Playback skipped past this frame while it was being read
+      if (generation != m_generation || sequence != m_nextRead)
+         continue;
+
+      m_bufferedBytes += frameBytes(frame);
+      m_window.push_back(std::move(frame));
+      m_nextRead++;
+      m_frameReady.notify_all();
+   }
+};
+
+// private static --------------------------------------------------------------------------------------------
+size_t FrameStream::frameBytes(const Frame& frame)
+{
+   return sizeof(Frame) + frame.getSprite().getPixels().capacity() * sizeof(Pixel);
+};
+
+// public ----------------------------------------------------------------------------------------------------
+bool FrameStream::takeFrame(const size_t index, Frame& frame, const bool wait)
+{
+   if (m_frameCount == 0 || index >= m_frameCount)
+      return false;
+
+   std::unique_lock<std::mutex> lock(m_mutex);
+   if (!m_prefetcher.joinable())
+   {
+      m_prefetcher = std::thread(&FrameStream::prefetchLoop, this);
+   }
+
+   size_t   current  = static_cast<size_t>(m_windowStart % m_frameCount);
+   uint64_t target   = m_windowStart + (index + m_frameCount - current) % m_frameCount;
+   bool     gotFrame = false;
+
+   // Drop the frames played over, keeping the newest in case the target itself is not read yet
+   while (!m_window.empty() && m_windowStart < target)
+   {
+      m_bufferedBytes -= frameBytes(m_window.front());
+      frame    = std::move(m_window.front());
+      gotFrame = true;
+      m_window.pop_front();
+      m_windowStart++;
+   }
+
+   if (m_window.empty() && m_windowStart < target)
+   {
+      // The prefetcher fell behind, send it straight to the target
+      m_windowStart = target;
+      m_nextRead    = target;
+      m_generation++;
+   }
+   m_spaceAvailable.notify_all();
+
+   if (m_window.empty() && wait)
+   {
+      m_frameReady.wait(lock, [this]() { return !m_window.empty(); });
+   }
+
+   if (m_window.empty())
+   {
+      m_underrunCount++;
+      return gotFrame;
+   }
+
+   m_bufferedBytes -= frameBytes(m_window.front());
+   frame = std::move(m_window.front());
+   m_window.pop_front();
+   m_windowStart++;
+   m_spaceAvailable.notify_all();
+   return true;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+std::shared_ptr<FrameStream> FrameStream::clone() const
+{
+   auto stream         = std::make_shared<FrameStream>(m_frameCount, m_readFrame, getMemoryCap());
+   stream->m_readMutex = m_readMutex;
+   return stream;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t FrameStream::getFrameCount() const
+{
+   return m_frameCount;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void FrameStream::setMemoryCap(const size_t memoryCap)
+{
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_memoryCap = memoryCap;
+   }
+   m_spaceAvailable.notify_all();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t FrameStream::getMemoryCap() const
+{
+   std::lock_guard<std::mutex> lock(m_mutex);
+   return m_memoryCap;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t FrameStream::getBufferedBytes() const
+{
+   std::lock_guard<std::mutex> lock(m_mutex);
+   return m_bufferedBytes;
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t FrameStream::getBufferedFrameCount() const
+{
+   std::lock_guard<std::mutex> lock(m_mutex);
+   return m_window.size();
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t FrameStream::getUnderrunCount() const
+{
+   std::lock_guard<std::mutex> lock(m_mutex);
+   return m_underrunCount;
+};
@@ -10,58 +10,254 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../../include/PrintableFactory.h"
+#include "../../include/AnimationArchive.h"
+#include "../../include/AnimationSheet.h"
+#include "../../include/FrameStream.h"
+#include "../../include/ThreadPool.h"
 #include <algorithm>
-#include <codecvt>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
-#include <locale>
 #include <memory>
-#include <sstream> // for stringstream
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
-// public static ---------------------------------------------------------------------------------------------
-Frame PrintableFactory::getFrameFromTextFile(const std::string fileLocation)
+// Asynchronous loads waiting for completePendingLoads, only touched on the main thread
+static std::vector<std::function<bool()>> pendingLoads;
+
+// private static --------------------------------------------------------------------------------------------
+static bool nextLine(const char*& cursor, const char* end, std::string_view& line)
 {
-   std::ifstream inputFile(fileLocation);
+   if (cursor >= end)
+      return false;
 
-   if (!inputFile.is_open())
+   const char* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+   if (lineEnd == nullptr)
+      lineEnd = end;
+
+   line   = std::string_view(cursor, lineEnd - cursor);
+   cursor = lineEnd < end ? lineEnd + 1 : end;
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool isBlank(const char c)
+{
+   return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool nextToken(std::string_view& line, std::string_view& token)
+{
+   const char* start = line.data();
+   const char* end   = start + line.size();
+   while (start < end && isBlank(*start))
+      ++start;
+   if (start == end)
+      return false;
+
+   const char* stop = start;
+   while (stop < end && !isBlank(*stop))
+      ++stop;
+
+   token = std::string_view(start, stop - start);
+   line  = std::string_view(stop, end - stop);
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool parseInt(const char* begin, const char* end, int& value)
+{
+   if (begin < end && *begin == '+')
+      ++begin;
+
+   return std::from_chars(begin, end, value).ec == std::errc();
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void parseRGB(const std::string_view token, RGB& color)
+{
+   const char* begin = token.data();
+   const char* end   = begin + token.size();
+   const char* p1    = static_cast<const char*>(std::memchr(begin, ',', token.size()));
+   if (p1 == nullptr)
+      return;
+   const char* p2 = static_cast<const char*>(std::memchr(p1 + 1, ',', end - p1 - 1));
+   if (p2 == nullptr)
+      return;
+
+   int r = color.getR(), g = color.getG(), b = color.getB();
+   parseInt(begin, p1, r);
+   parseInt(p1 + 1, p2, g);
+   parseInt(p2 + 1, end, b);
+   color = RGB(r, g, b);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void parseColorRows(const char*& cursor, const char* end, const int height, const int width,
+                           std::vector<RGB>& colors)
+{
+   std::string_view line;
+   std::string_view token;
+   for (int y = 0; y < height; ++y)
    {
-      std::cerr << "Error opening the file: " << fileLocation << std::endl;
-      std::vector<Pixel> errorPixels;
-      errorPixels.push_back(Pixel(Position(0, 0), '~'));
-      return Frame(Sprite(errorPixels), 1.0f);
+      if (!nextLine(cursor, end, line))
+         break;
+      for (int x = 0; x < width && nextToken(line, token); ++x)
+      {
+         parseRGB(token, colors[y * width + x]);
+      }
    }
+}
 
-   std::string        line;
-   std::vector<Pixel> pixels;
+// private static --------------------------------------------------------------------------------------------
+static void parseSparseStyles(const char*& cursor, const char* end, const int height, const int width,
+                              std::vector<RGB>& textRGBs, std::vector<RGB>& bgRGBs,
+                              std::vector<attr_t>& attrs)
+{
+   std::string_view line;
+   std::string_view tag;
+   std::string_view token;
+   while (nextLine(cursor, end, line))
+   {
+      if (!nextToken(line, tag))
+         continue;
 
-   // Parse first line to get frame duration and sprite layer
-   getline(inputFile, line);
-   std::stringstream ss(line);
-   std::string       value;
-   float             duration = 1.0f;
-   int               layer    = 0;
+      // default text background attributes, applies to every cell
+      if (tag == "default")
+      {
+         RGB text       = textRGBs.empty() ? RGB(1000, 1000, 1000) : textRGBs.front();
+         RGB background = bgRGBs.empty() ? RGB(0, 0, 0) : bgRGBs.front();
+         int attr       = attrs.empty() ? A_NORMAL : static_cast<int>(attrs.front());
+         if (nextToken(line, token))
+            parseRGB(token, text);
+         if (nextToken(line, token))
+            parseRGB(token, background);
+         if (nextToken(line, token))
+            parseInt(token.data(), token.data() + token.size(), attr);
+         std::fill(textRGBs.begin(), textRGBs.end(), text);
+         std::fill(bgRGBs.begin(), bgRGBs.end(), background);
+         std::fill(attrs.begin(), attrs.end(), static_cast<attr_t>(attr));
+         continue;
+      }
+
+      // section y x count value, a run of cells on one row that differ from the default
+      int              fields[3];
+      bool             valid = tag.size() == 1;
+      std::string_view field;
+      for (int i = 0; i < 3 && valid; i++)
+      {
+         valid = nextToken(line, field) && parseInt(field.data(), field.data() + field.size(), fields[i]);
+      }
+      if (!valid || !nextToken(line, token))
+         continue;
 
-   if (getline(ss, value, ','))
+      int y = fields[0], x = fields[1], count = fields[2];
+      if (y < 0 || y >= height || x < 0 || x >= width || count <= 0)
+         continue;
+      size_t first = y * width + x;
+      size_t last  = y * width + std::min(width, x + count);
+      if (tag[0] == 't' || tag[0] == 'b')
+      {
+         std::vector<RGB>& colors = tag[0] == 't' ? textRGBs : bgRGBs;
+         RGB               color  = colors[first];
+         parseRGB(token, color);
+         std::fill(colors.begin() + first, colors.begin() + last, color);
+      }
+      else if (tag[0] == 'a')
+      {
+         int attr = 0;
+         if (parseInt(token.data(), token.data() + token.size(), attr))
+            std::fill(attrs.begin() + first, attrs.begin() + last, static_cast<attr_t>(attr));
+      }
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void parseFrameHeader(const std::string_view line, float& duration, int& layer)
+{
+   size_t           comma        = line.find(',');
+   std::string_view durationText = line.substr(0, comma);
+   std::from_chars(durationText.data(), durationText.data() + durationText.size(), duration);
+   if (comma != std::string_view::npos)
+   {
+      parseInt(line.data() + comma + 1, line.data() + line.size(), layer);
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static wchar_t decodeUtf8(const char*& cursor, const char* end)
+{
+   unsigned char lead = static_cast<unsigned char>(*cursor++);
+   if (lead < 0x80)
+      return lead;
+
+   int      continuationBytes;
+   uint32_t codePoint;
+   if ((lead & 0xE0) == 0xC0)
+   {
+      continuationBytes = 1;
+      codePoint         = lead & 0x1F;
+   }
+   else if ((lead & 0xF0) == 0xE0)
    {
-      duration = std::stof(value);
+      continuationBytes = 2;
+      codePoint         = lead & 0x0F;
    }
-   if (getline(ss, value, ','))
+   else if ((lead & 0xF8) == 0xF0)
+   {
+      continuationBytes = 3;
+      codePoint         = lead & 0x07;
+   }
+   else
+   {
+      return 0xFFFD; // Stray continuation byte or invalid lead byte
+   }
+
+   for (int i = 0; i < continuationBytes; i++)
+   {
+      if (cursor >= end || (static_cast<unsigned char>(*cursor) & 0xC0) != 0x80)
+         return 0xFFFD; // Truncated sequence
+      codePoint = (codePoint << 6) | (static_cast<unsigned char>(*cursor++) & 0x3F);
+   }
+   return static_cast<wchar_t>(codePoint);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static Frame parseTextFrame(const std::string_view text)
+{
+   const char*      cursor = text.data();
+   const char*      end    = cursor + text.size();
+   std::string_view line;
+
+   // Parse first line to get frame duration and sprite layer
+   float duration = 1.0f;
+   int   layer    = 0;
+   if (nextLine(cursor, end, line))
    {
-      layer = std::stoi(value);
+      parseFrameHeader(line, duration, layer);
    }
 
    // Read ASCII art lines until delimiter '---' or end of file
-   std::vector<std::string> asciiLines;
-   bool                     foundDelimiter = false;
-   while (getline(inputFile, line))
+   std::vector<std::string_view> asciiLines;
+   bool                          foundDelimiter = false;
+   bool                          sparse         = false;
+   while (nextLine(cursor, end, line))
    {
-      if (line == "---")
+      if (line == "---" || line == "---sparse")
       {
          foundDelimiter = true;
+         sparse         = line.size() > 3;
          break;
       }
       asciiLines.push_back(line);
@@ -73,181 +269,906 @@ Frame PrintableFactory::getFrameFromTextFile(const std::string fileLocation)
       if ((int)l.size() > width)
          width = l.size();
 
-   // Default color values (white text, black background, normal attributes)
-   std::vector<std::vector<RGB>>    textRGBs(height, std::vector<RGB>(width, RGB(1000, 1000, 1000)));
-   std::vector<std::vector<RGB>>    bgRGBs(height, std::vector<RGB>(width, RGB(0, 0, 0)));
-   std::vector<std::vector<attr_t>> attrs(height, std::vector<attr_t>(width, A_NORMAL));
+   // Default color values (white text, black background, normal attributes), one entry per cell row major
+   std::vector<RGB>    textRGBs(height * width, RGB(1000, 1000, 1000));
+   std::vector<RGB>    bgRGBs(height * width, RGB(0, 0, 0));
+   std::vector<attr_t> attrs(height * width, A_NORMAL);
 
    // Only read color/attribute data if delimiter was found
-   if (foundDelimiter)
+   if (foundDelimiter && sparse)
    {
-      // Read text RGB lines
-      for (int y = 0; y < height; ++y)
-      {
-         if (!getline(inputFile, line))
-            break;
-         std::stringstream ss(line);
-         for (int x = 0; x < width; ++x)
-         {
-            std::string pixelStr;
-            if (!(ss >> pixelStr))
-               break;
-            int    r = 1000, g = 1000, b = 1000;
-            size_t p1 = pixelStr.find(',');
-            size_t p2 = pixelStr.find(',', p1 + 1);
-            if (p1 != std::string::npos && p2 != std::string::npos)
-            {
-               r = std::stoi(pixelStr.substr(0, p1));
-               g = std::stoi(pixelStr.substr(p1 + 1, p2 - p1 - 1));
-               b = std::stoi(pixelStr.substr(p2 + 1));
-            }
-            textRGBs[y][x] = RGB(r, g, b);
-         }
-      }
-
-      // Read background RGB lines
-      for (int y = 0; y < height; ++y)
-      {
-         if (!getline(inputFile, line))
-            break;
-         std::stringstream ss(line);
-         for (int x = 0; x < width; ++x)
-         {
-            std::string pixelStr;
-            if (!(ss >> pixelStr))
-               break;
-            int    r = 0, g = 0, b = 0;
-            size_t p1 = pixelStr.find(',');
-            size_t p2 = pixelStr.find(',', p1 + 1);
-            if (p1 != std::string::npos && p2 != std::string::npos)
-            {
-               r = std::stoi(pixelStr.substr(0, p1));
-               g = std::stoi(pixelStr.substr(p1 + 1, p2 - p1 - 1));
-               b = std::stoi(pixelStr.substr(p2 + 1));
-            }
-            bgRGBs[y][x] = RGB(r, g, b);
-         }
-      }
+      parseSparseStyles(cursor, end, height, width, textRGBs, bgRGBs, attrs);
+   }
+   else if (foundDelimiter)
+   {
+      parseColorRows(cursor, end, height, width, textRGBs);
+      parseColorRows(cursor, end, height, width, bgRGBs);
 
       // Read attribute lines
+      std::string_view token;
       for (int y = 0; y < height; ++y)
       {
-         if (!getline(inputFile, line))
+         if (!nextLine(cursor, end, line))
             break;
-         std::stringstream ss(line);
-         for (int x = 0; x < width; ++x)
+         for (int x = 0; x < width && nextToken(line, token); ++x)
          {
             int attr = 0;
-            if (!(ss >> attr))
+            if (!parseInt(token.data(), token.data() + token.size(), attr))
                break;
-            attrs[y][x] = static_cast<attr_t>(attr);
+            attrs[y * width + x] = static_cast<attr_t>(attr);
          }
       }
    }
 
-   // Compose pixels
-   std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+   // Compose pixels, a line never decodes to more characters than it has bytes so x stays below width
+   std::vector<Pixel> pixels;
+   pixels.reserve(height * width);
    for (int y = 0; y < height; ++y)
    {
-      std::wstring wline = converter.from_bytes(asciiLines[y]);
-      for (int x = 0; x < (int)wline.size(); ++x)
+      const char* glyph   = asciiLines[y].data();
+      const char* lineEnd = glyph + asciiLines[y].size();
+      for (int x = 0; glyph < lineEnd; ++x)
       {
-         wchar_t ch        = wline[x];
-         RGB     textColor = textRGBs[y][x];
-         RGB     bgColor   = bgRGBs[y][x];
-         attr_t  attr      = attrs[y][x];
-         pixels.push_back(Pixel(Position(x, y), ch, textColor, bgColor, attr));
+         wchar_t ch   = decodeUtf8(glyph, lineEnd);
+         size_t  cell = y * width + x;
+         pixels.emplace_back(Position(x, y), ch, textRGBs[cell], bgRGBs[cell], attrs[cell]);
       }
    }
-   Sprite sprite   = Sprite(pixels, layer);
-   Frame  newFrame = Frame(sprite, duration);
+   return Frame(Sprite(std::move(pixels), layer), duration);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+Frame PrintableFactory::getFrameFromTextFile(const std::string fileLocation)
+{
+   std::ifstream inputFile(fileLocation, std::ios::binary | std::ios::ate);
+
+   if (!inputFile.is_open())
+   {
+      std::cerr << "Error opening the file: " << fileLocation << std::endl;
+      std::vector<Pixel> errorPixels;
+      errorPixels.push_back(Pixel(Position(0, 0), '~'));
+      return Frame(Sprite(errorPixels), 1.0f);
+   }
+
+   // Read the whole file into one buffer, every section is parsed in place from it
+   std::streamoff    fileSize = inputFile.tellg();
+   std::vector<char> buffer(fileSize > 0 ? static_cast<size_t>(fileSize) : 0);
+   inputFile.seekg(0);
+   inputFile.read(buffer.data(), buffer.size());
    inputFile.close();
-   return newFrame;
+
+   return parseTextFrame(std::string_view(buffer.data(), buffer.size()));
 }
 
 // public static ---------------------------------------------------------------------------------------------
-Animation PrintableFactory::loadAnimation(std::string entityName, std::string animationName, bool repeats)
+Animation PrintableFactory::loadAnimation(std::string entityName, std::string animationName, bool repeats,
+                                          const size_t keyframeInterval)
 {
    namespace fs                  = std::filesystem;
-   std::string        folderPath = "src/Animations/" + entityName + "/" + animationName;
+   std::string        entityPath = "src/Animations/" + entityName;
+   std::string        folderPath = entityPath + "/" + animationName;
    std::vector<Frame> frames;
 
+   AnimationArchive                        archive;
+   const AnimationArchive::AnimationEntry* archived = nullptr;
+   if (isArchiveCurrent(entityPath) && archive.open(entityPath + AnimationArchive::EXTENSION))
+      archived = archive.findAnimation(animationName);
+   if (archived != nullptr)
+   {
+      loadArchiveFrames(archive, *archived, frames);
+      return buildAnimation(animationName, std::move(frames), repeats, keyframeInterval);
+   }
+
    try
    {
-      std::vector<fs::directory_entry> entries;
-      for (const auto& entry : fs::directory_iterator(folderPath))
+      std::vector<fs::directory_entry> entries = getTextFrameFiles(folderPath);
+      if (!loadCompiledFrames(folderPath, entries, frames) && !loadSheetFrames(folderPath, frames))
       {
-         if (entry.is_regular_file())
-         {
-            entries.push_back(entry);
-         }
+         // Frames are parsed concurrently, each into its own slot, so order follows the sorted filenames
+         frames.resize(entries.size());
+         ThreadPool::getLoaderPool().parallelFor(
+               entries.size(), [&entries, &frames](size_t i)
+               { frames[i] = getFrameFromTextFile(entries[i].path().string()); });
       }
-      // Sort by filename
-      std::sort(entries.begin(), entries.end(), [](const fs::directory_entry& a, const fs::directory_entry& b)
-                { return a.path().filename().string() < b.path().filename().string(); });
 
-      for (const auto& entry : entries)
+      Animation animation = buildAnimation(animationName, std::move(frames), repeats, keyframeInterval);
+      return animation;
+   }
+   catch (const fs::filesystem_error& e)
+   {
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return Animation();
+   }
+}
+
+// public static ---------------------------------------------------------------------------------------------
+size_t PrintableFactory::reloadTextFrames(const std::string               folderPath,
+                                          const std::vector<std::string>& fileNames,
+                                          std::vector<size_t>& frameIndices, std::vector<Frame>& frames)
+{
+   frameIndices.clear();
+   frames.clear();
+
+   std::vector<fs::directory_entry> entries;
+   try
+   {
+      entries = getTextFrameFiles(folderPath);
+   }
+   catch (const fs::filesystem_error& e)
+   {
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return 0;
+   }
+
+   std::unordered_map<std::string, size_t> position;
+   for (size_t i = 0; i < entries.size(); i++)
+   {
+      position[entries[i].path().filename().string()] = i;
+   }
+   for (const std::string& fileName : fileNames)
+   {
+      auto found = position.find(fileName);
+      if (found != position.end())
+         frameIndices.push_back(found->second);
+   }
+
+   frames.resize(frameIndices.size());
+   ThreadPool::getLoaderPool().parallelFor(
+         frameIndices.size(), [&entries, &frameIndices, &frames](size_t i)
+         { frames[i] = getFrameFromTextFile(entries[frameIndices[i]].path().string()); });
+   return entries.size();
+}
+
+// public static ---------------------------------------------------------------------------------------------
+Animation PrintableFactory::streamAnimation(const std::string entityName, const std::string animationName,
+                                            const bool repeats, const size_t memoryCap)
+{
+   std::string        entityPath = "src/Animations/" + entityName;
+   std::string        folderPath = entityPath + "/" + animationName;
+   std::vector<Frame> frameHeaders;
+
+   // Frame headers are in the archive's index, each frame is one pread on the prefetch thread
+   auto                                    archive  = std::make_shared<AnimationArchive>();
+   const AnimationArchive::AnimationEntry* archived = nullptr;
+   if (isArchiveCurrent(entityPath) && archive->open(entityPath + AnimationArchive::EXTENSION))
+      archived = archive->findAnimation(animationName);
+   if (archived != nullptr && !archived->frames.empty())
+   {
+      for (const AnimationArchive::FrameEntry& entry : archived->frames)
       {
-         std::string fileName     = entry.path().filename().string();
-         std::string fullFilePath = folderPath + "/" + fileName;
-         frames.push_back(getFrameFromTextFile(fullFilePath));
+         frameHeaders.push_back(Frame(Sprite(std::vector<Pixel>(), entry.layer), entry.duration));
       }
-      Animation animation = Animation(animationName, frames, repeats);
-      if (frames.size() == 1)
+      auto stream = std::make_shared<FrameStream>(
+            frameHeaders.size(),
+            [archive, archived](size_t index)
+            {
+               std::string text;
+               if (!archive->readFrame(archived->frames[index], text))
+               {
+                  std::cerr << "Failed to read frame " << index << " of '" << archived->name
+                            << "' from archive" << std::endl;
+                  return Frame();
+               }
+               return parseTextFrame(text);
+            },
+            memoryCap);
+
+      Animation animation(animationName, std::move(frameHeaders), repeats);
+      animation.setStream(stream);
+      if (animation.getTotalFrames() == 1)
       {
          animation.setPlaying(false);
       }
       return animation;
    }
+
+   std::vector<fs::directory_entry>    entries;
+   std::vector<AnimationSheet::Record> sheetRecords;
+   AnimationManifest                   manifest;
+   try
+   {
+      entries = getTextFrameFiles(folderPath, &manifest);
+   }
    catch (const fs::filesystem_error& e)
    {
       std::cerr << "Filesystem error: " << e.what() << std::endl;
       return Animation();
    }
+
+   // Only the frame table is read up front, frame cells are read by the stream's prefetch thread
+   std::shared_ptr<FrameStream>   stream;
+   std::shared_ptr<AnimationFile> animationFile = std::make_shared<AnimationFile>();
+   std::string                    binaryPath    = folderPath + "/" + AnimationFile::FILE_NAME;
+   if (animationFile->open(binaryPath) && animationFile->getFrameCount() > 0 &&
+       isCompiledCurrent(folderPath, entries, animationFile->getFrameCount()))
+   {
+      frameHeaders.reserve(animationFile->getFrameCount());
+      for (size_t i = 0; i < animationFile->getFrameCount(); i++)
+      {
+         const AnimationFile::FrameEntry& entry = animationFile->getFrameEntry(i);
+         frameHeaders.push_back(Frame(Sprite(std::vector<Pixel>(), entry.layer), entry.duration));
+      }
+      stream = std::make_shared<FrameStream>(frameHeaders.size(),
+                                             [animationFile](size_t index)
+                                             {
+                                                Frame frame = animationFile->getFrame(index);
+                                                animationFile->releaseFrame(index);
+                                                return frame;
+                                             },
+                                             memoryCap);
+   }
+   else if (AnimationSheet::readIndex(folderPath + "/" + AnimationSheet::FILE_NAME, sheetRecords) &&
+            !sheetRecords.empty())
+   {
+      frameHeaders.reserve(sheetRecords.size());
+      for (const AnimationSheet::Record& record : sheetRecords)
+      {
+         float duration = 1.0f;
+         int   layer    = 0;
+         parseFrameHeader(record.headerLine, duration, layer);
+         frameHeaders.push_back(Frame(Sprite(std::vector<Pixel>(), layer), duration));
+      }
+
+      // One open handle for the whole stream, records are read by offset on the prefetch thread only
+      auto sheet = std::make_shared<std::ifstream>(folderPath + "/" + AnimationSheet::FILE_NAME,
+                                                   std::ios::binary);
+      stream     = std::make_shared<FrameStream>(
+          frameHeaders.size(),
+          [sheet, sheetRecords](size_t index)
+          {
+             const AnimationSheet::Record& record = sheetRecords[index];
+             std::vector<char>             text(record.size);
+             sheet->clear();
+             sheet->seekg(static_cast<std::streamoff>(record.offset));
+             sheet->read(text.data(), text.size());
+             return parseTextFrame(std::string_view(text.data(), static_cast<size_t>(sheet->gcount())));
+          },
+          memoryCap);
+   }
+   else if (!entries.empty())
+   {
+      std::vector<std::string> frameFiles;
+      frameFiles.reserve(entries.size());
+      frameHeaders.reserve(entries.size());
+      for (size_t i = 0; i < entries.size(); i++)
+      {
+         frameFiles.push_back(entries[i].path().string());
+         if (manifest.getFrameCount() == entries.size())
+         {
+            const AnimationManifest::FrameInfo& info = manifest.getFrames()[i];
+            frameHeaders.push_back(Frame(Sprite(std::vector<Pixel>(), info.layer), info.duration));
+         }
+         else
+         {
+            frameHeaders.push_back(readFrameHeader(frameFiles.back()));
+         }
+      }
+      stream = std::make_shared<FrameStream>(
+          frameHeaders.size(), [frameFiles](size_t index) { return getFrameFromTextFile(frameFiles[index]); },
+          memoryCap);
+   }
+   else
+   {
+      return Animation();
+   }
+
+   Animation animation(animationName, std::move(frameHeaders), repeats);
+   animation.setStream(stream);
+   if (animation.getTotalFrames() == 1)
+   {
+      animation.setPlaying(false);
+   }
+   return animation;
 }
 
 // public static ---------------------------------------------------------------------------------------------
-std::shared_ptr<Entity> PrintableFactory::loadEntity(const std::string entityName, bool visable,
-                                                     bool                           moveableByCamera,
-                                                     std::shared_ptr<NcursesWindow> ncursesWindow)
+bool PrintableFactory::compileAnimation(const std::string folderPath)
 {
-   std::vector<Animation> animations;
-   std::string            basePath = "src/Animations/" + entityName;
+   std::vector<Frame> frames;
+   try
+   {
+      std::vector<fs::directory_entry> entries = getTextFrameFiles(folderPath);
+      if (!loadSheetFrames(folderPath, frames))
+      {
+         for (const auto& entry : entries)
+         {
+            frames.push_back(getFrameFromTextFile(entry.path().string()));
+         }
+      }
+   }
+   catch (const fs::filesystem_error& e)
+   {
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return false;
+   }
 
+   if (frames.empty())
+      return false;
+
+   return AnimationFile::write(folderPath + "/" + AnimationFile::FILE_NAME, frames);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool PrintableFactory::describeAnimation(const std::string entityName, const std::string animationName,
+                                         AnimationManifest& manifest)
+{
+   std::string folderPath = "src/Animations/" + entityName + "/" + animationName;
    try
    {
-      for (const auto& entry : fs::directory_iterator(basePath))
+      manifest = AnimationManifest();
+      std::vector<fs::directory_entry> entries = getTextFrameFiles(folderPath, &manifest);
+      std::vector<char>                sheetBuffer;
+      std::vector<std::string_view>    sheetFrames;
+      if (AnimationSheet::read(folderPath + "/" + AnimationSheet::FILE_NAME, sheetBuffer, sheetFrames))
       {
-         if (entry.is_directory())
+         std::vector<AnimationManifest::FrameInfo> frameInfos(sheetFrames.size());
+         ThreadPool::getLoaderPool().parallelFor(
+               sheetFrames.size(),
+               [&sheetFrames, &frameInfos](size_t i)
+               {
+                  const std::string_view text      = sheetFrames[i];
+                  std::string            frameName = AnimationSheet::FILE_NAME + (":" + std::to_string(i));
+                  frameInfos[i] = AnimationManifest::describeFrame(frameName, parseTextFrame(text),
+                                                                   AnimationManifest::hash(text.data(),
+                                                                                           text.size()));
+               });
+         manifest = AnimationManifest();
+         for (const AnimationManifest::FrameInfo& info : frameInfos)
          {
-            std::string animationName = entry.path().filename().string();
-            Animation   anim          = loadAnimation(entityName, animationName, true);
-            animations.push_back(anim);
+            manifest.addFrame(info);
          }
       }
+      else if (manifest.getFrameCount() != entries.size())
+      {
+         buildManifest(entries, manifest);
+      }
+      return true;
    }
    catch (const fs::filesystem_error& e)
    {
-      std::cerr << "Error loading animations for entity '" << entityName << "': " << e.what() << std::endl;
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return false;
    }
-   auto entity = std::make_shared<Entity>(entityName, animations, visable, moveableByCamera);
+}
 
-   if (ncursesWindow != nullptr)
+// public static ---------------------------------------------------------------------------------------------
+bool PrintableFactory::writeManifest(const std::string folderPath)
+{
+   // A sheet lists its own frames in order, it needs no manifest
+   std::error_code sheetError;
+   if (fs::exists(folderPath + "/" + AnimationSheet::FILE_NAME, sheetError))
+      return true;
+
+   AnimationManifest manifest;
+   try
    {
-      entity->setNcurseWindow(ncursesWindow->getWindow());
-      ncursesWindow->addPrintable(entity);
-      ncursesWindow->setPrintablesNeedSorted(true);
+      buildManifest(getTextFrameFiles(folderPath), manifest);
    }
-   else if (!ncursesWindows.empty())
+   catch (const fs::filesystem_error& e)
    {
-      entity->setNcurseWindow(ncursesWindows.at(0)->getWindow());
-      ncursesWindows.at(0)->addPrintable(entity);
-      ncursesWindows.at(0)->setPrintablesNeedSorted(true);
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return false;
    }
-   else
+
+   return manifest.write(folderPath + "/" + AnimationManifest::FILE_NAME);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool PrintableFactory::validateAnimation(const std::string folderPath, const bool checkContents,
+                                         std::vector<std::string>& problems)
+{
+   size_t                           problemCount = problems.size();
+   std::vector<fs::directory_entry> entries;
+   try
+   {
+      entries = getTextFrameFiles(folderPath);
+   }
+   catch (const fs::filesystem_error& e)
+   {
+      problems.push_back(std::string("Filesystem error: ") + e.what());
+      return false;
+   }
+
+   std::string     sheetPath = folderPath + "/" + AnimationSheet::FILE_NAME;
+   std::error_code sheetError;
+   if (fs::exists(sheetPath, sheetError))
+   {
+      std::vector<char>             sheetBuffer;
+      std::vector<std::string_view> sheetFrames;
+      if (!AnimationSheet::read(sheetPath, sheetBuffer, sheetFrames))
+      {
+         problems.push_back("Invalid animation sheet: " + sheetPath);
+      }
+      for (const auto& entry : entries)
+      {
+         problems.push_back("Frame file ignored next to animation sheet: " + entry.path().string());
+      }
+      return problems.size() == problemCount;
+   }
+
+   std::string       manifestPath = folderPath + "/" + AnimationManifest::FILE_NAME;
+   AnimationManifest manifest;
+   if (!manifest.read(manifestPath))
+   {
+      problems.push_back("Missing or invalid manifest: " + manifestPath);
+      return false;
+   }
+
+   std::unordered_map<std::string, bool> onDisk;
+   for (const auto& entry : entries)
+   {
+      onDisk[entry.path().filename().string()] = true;
+   }
+
+   std::unordered_map<std::string, bool> listed;
+   for (const AnimationManifest::FrameInfo& info : manifest.getFrames())
+   {
+      std::string frameFile = folderPath + "/" + info.fileName;
+      listed[info.fileName] = true;
+      if (onDisk.count(info.fileName) == 0)
+      {
+         problems.push_back("Missing frame file: " + frameFile);
+         continue;
+      }
+
+      uint64_t fileHash = 0;
+      if (checkContents && (!AnimationManifest::hashFile(frameFile, fileHash) || fileHash != info.hash))
+      {
+         problems.push_back("Frame file changed since the manifest was written: " + frameFile);
+      }
+   }
+
+   for (const auto& entry : entries)
+   {
+      if (listed.count(entry.path().filename().string()) == 0)
+      {
+         problems.push_back("Frame file not in manifest: " + entry.path().string());
+      }
+   }
+   return problems.size() == problemCount;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static std::string_view digitRun(const std::string& text, size_t& index)
+{
+   size_t start = index;
+   while (index < text.size() && std::isdigit(static_cast<unsigned char>(text[index])))
+      index++;
+
+   // Leading zeros do not change the value, keep one digit so 0 still compares
+   while (start + 1 < index && text[start] == '0')
+      start++;
+   return std::string_view(text).substr(start, index - start);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool naturalLess(const std::string& a, const std::string& b)
+{
+   // Runs of digits compare by value, so frame2 comes before frame10
+   size_t i = 0, j = 0;
+   while (i < a.size() && j < b.size())
+   {
+      if (std::isdigit(static_cast<unsigned char>(a[i])) && std::isdigit(static_cast<unsigned char>(b[j])))
+      {
+         std::string_view aNumber = digitRun(a, i);
+         std::string_view bNumber = digitRun(b, j);
+         if (aNumber.size() != bNumber.size())
+            return aNumber.size() < bNumber.size();
+         if (aNumber != bNumber)
+            return aNumber < bNumber;
+         continue;
+      }
+
+      if (a[i] != b[j])
+         return a[i] < b[j];
+      i++;
+      j++;
+   }
+   if (a.size() - i != b.size() - j)
+      return a.size() - i < b.size() - j;
+   return a < b; // Equal apart from leading zeros, still needs a strict order
+}
+
+// private static --------------------------------------------------------------------------------------------
+std::vector<fs::directory_entry> PrintableFactory::getTextFrameFiles(const std::string folderPath,
+                                                                     AnimationManifest* manifest)
+{
+   const std::string                reservedNames[] = {AnimationFile::FILE_NAME, AnimationManifest::FILE_NAME,
+                                                       AnimationSheet::FILE_NAME};
+   std::vector<fs::directory_entry> entries;
+   for (const auto& entry : fs::directory_iterator(folderPath))
+   {
+      std::string fileName = entry.path().filename().string();
+      // Temporary files of an interrupted save are never frames
+      bool reserved = fileName.size() >= 4 && fileName.compare(fileName.size() - 4, 4, ".tmp") == 0;
+      for (const std::string& reservedName : reservedNames)
+      {
+         reserved = reserved || fileName == reservedName;
+      }
+      if (entry.is_regular_file() && !reserved)
+      {
+         entries.push_back(entry);
+      }
+   }
+   std::sort(entries.begin(), entries.end(), [](const fs::directory_entry& a, const fs::directory_entry& b)
+             { return naturalLess(a.path().filename().string(), b.path().filename().string()); });
+
+   AnimationManifest current;
+   if (loadManifest(folderPath, entries, current))
+   {
+      // A current manifest lists exactly these files, its order wins
+      std::unordered_map<std::string, size_t> position;
+      for (size_t i = 0; i < current.getFrameCount(); i++)
+      {
+         position[current.getFrames()[i].fileName] = i;
+      }
+      std::vector<fs::directory_entry> ordered(entries.size());
+      for (const auto& entry : entries)
+      {
+         ordered[position[entry.path().filename().string()]] = entry;
+      }
+      entries.swap(ordered);
+
+      if (manifest != nullptr)
+         *manifest = std::move(current);
+   }
+   return entries;
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::loadManifest(const std::string                       folderPath,
+                                    const std::vector<fs::directory_entry>& textFrameFiles,
+                                    AnimationManifest&                      manifest)
+{
+   std::string     manifestPath = folderPath + "/" + AnimationManifest::FILE_NAME;
+   std::error_code manifestError;
+   auto            manifestTime = fs::last_write_time(manifestPath, manifestError);
+   if (manifestError || !manifest.read(manifestPath) || manifest.getFrameCount() != textFrameFiles.size())
+      return false;
+
+   // Stale once a frame was edited after the manifest was written, or frames were added, removed or renamed
+   std::unordered_map<std::string, bool> listed;
+   for (const AnimationManifest::FrameInfo& info : manifest.getFrames())
+   {
+      listed[info.fileName] = true;
+   }
+   for (const auto& entry : textFrameFiles)
+   {
+      if (entry.last_write_time() > manifestTime || listed.count(entry.path().filename().string()) == 0)
+         return false;
+   }
+   return listed.size() == textFrameFiles.size();
+}
+
+// private static --------------------------------------------------------------------------------------------
+void PrintableFactory::buildManifest(const std::vector<fs::directory_entry>& textFrameFiles,
+                                     AnimationManifest&                      manifest)
+{
+   // Each frame is described in its own slot and dropped, so only one parsed frame per loader thread is held
+   std::vector<AnimationManifest::FrameInfo> frameInfos(textFrameFiles.size());
+   ThreadPool::getLoaderPool().parallelFor(textFrameFiles.size(),
+                                           [&textFrameFiles, &frameInfos](size_t i)
+                                           {
+                                              std::string frameFile = textFrameFiles[i].path().string();
+                                              uint64_t    fileHash  = 0;
+                                              AnimationManifest::hashFile(frameFile, fileHash);
+                                              frameInfos[i] = AnimationManifest::describeFrame(
+                                                    textFrameFiles[i].path().filename().string(),
+                                                    getFrameFromTextFile(frameFile), fileHash);
+                                           });
+
+   manifest = AnimationManifest();
+   for (const AnimationManifest::FrameInfo& info : frameInfos)
+   {
+      manifest.addFrame(info);
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::isCompiledCurrent(const std::string                       folderPath,
+                                         const std::vector<fs::directory_entry>& textFrameFiles,
+                                         const size_t                            compiledFrameCount)
+{
+   // Deleting or renaming a frame keeps the other mtimes, the frame count and the manifest catch those. A
+   // sheet only directory has no text frames to count.
+   if (!textFrameFiles.empty() && compiledFrameCount != textFrameFiles.size())
+      return false;
+
+   // Prefer the compiled file unless a text frame was edited after it was compiled
+   std::error_code binaryError;
+   auto binaryTime = fs::last_write_time(folderPath + "/" + AnimationFile::FILE_NAME, binaryError);
+   if (binaryError)
+      return false;
+
+   for (const char* sourceName : {AnimationSheet::FILE_NAME, AnimationManifest::FILE_NAME})
+   {
+      std::error_code sourceError;
+      auto            sourceTime = fs::last_write_time(folderPath + "/" + sourceName, sourceError);
+      if (!sourceError && sourceTime > binaryTime)
+         return false;
+   }
+
+   for (const auto& entry : textFrameFiles)
+   {
+      if (entry.last_write_time() > binaryTime)
+         return false;
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+Frame PrintableFactory::readFrameHeader(const std::string fileLocation)
+{
+   float duration = 1.0f;
+   int   layer    = 0;
+
+   std::ifstream inputFile(fileLocation);
+   std::string   line;
+   if (std::getline(inputFile, line))
+   {
+      parseFrameHeader(line, duration, layer);
+   }
+   return Frame(Sprite(std::vector<Pixel>(), layer), duration);
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::isArchiveCurrent(const std::string entityFolderPath)
+{
+   std::error_code archiveError;
+   auto archiveTime = fs::last_write_time(entityFolderPath + AnimationArchive::EXTENSION, archiveError);
+   if (archiveError)
+      return false;
+
+   // Shipped without its directory tree, costs one stat instead of one per file
+   std::error_code treeError;
+   if (trustAnimationArchives || !fs::is_directory(entityFolderPath, treeError))
+      return true;
+
+   // Packed after the last edit to the tree. Deleting or renaming a frame or an animation directory only
+   // touches the directory that held it, so directories are compared as well. Files deleted mid walk are
+   // skipped.
+   std::error_code rootError;
+   auto            rootTime = fs::last_write_time(entityFolderPath, rootError);
+   if (!rootError && rootTime > archiveTime)
+      return false;
+
+   std::error_code walkError;
+   for (fs::recursive_directory_iterator entry(entityFolderPath, walkError), end; !walkError && entry != end;
+        entry.increment(walkError))
+   {
+      std::error_code fileError;
+      if (!entry->is_regular_file(fileError) && !entry->is_directory(fileError))
+         continue;
+
+      auto fileTime = entry->last_write_time(fileError);
+      if (!fileError && fileTime > archiveTime)
+         return false;
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+void PrintableFactory::loadArchiveFrames(const AnimationArchive&                 archive,
+                                         const AnimationArchive::AnimationEntry& archived,
+                                         std::vector<Frame>&                     frames)
+{
+   frames.clear();
+   frames.resize(archived.frames.size());
+   ThreadPool::getLoaderPool().parallelFor(archived.frames.size(),
+                                           [&archive, &archived, &frames](size_t i)
+                                           {
+                                              std::string text;
+                                              if (archive.readFrame(archived.frames[i], text))
+                                              {
+                                                 frames[i] = parseTextFrame(text);
+                                              }
+                                              else
+                                              {
+                                                 std::cerr << "Failed to read frame " << i << " of '"
+                                                           << archived.name << "' from archive" << std::endl;
+                                              }
+                                           });
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::loadSheetFrames(const std::string folderPath, std::vector<Frame>& frames)
+{
+   std::vector<char>             buffer;
+   std::vector<std::string_view> frameTexts;
+   if (!AnimationSheet::read(folderPath + "/" + AnimationSheet::FILE_NAME, buffer, frameTexts))
+      return false;
+
+   // One sequential read, then the records are parsed concurrently from the buffer
+   frames.clear();
+   frames.resize(frameTexts.size());
+   ThreadPool::getLoaderPool().parallelFor(frameTexts.size(), [&frameTexts, &frames](size_t i)
+                                           { frames[i] = parseTextFrame(frameTexts[i]); });
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::loadCompiledFrames(const std::string                       folderPath,
+                                          const std::vector<fs::directory_entry>& textFrameFiles,
+                                          std::vector<Frame>&                     frames)
+{
+   AnimationFile animationFile(folderPath + "/" + AnimationFile::FILE_NAME);
+   if (animationFile.getFrameCount() == 0 ||
+       !isCompiledCurrent(folderPath, textFrameFiles, animationFile.getFrameCount()))
+      return false;
+
+   frames.clear();
+   frames.reserve(animationFile.getFrameCount());
+   for (size_t i = 0; i < animationFile.getFrameCount(); i++)
+   {
+      frames.push_back(animationFile.getFrame(i));
+   }
+   return true;
+}
+
+// private static --------------------------------------------------------------------------------------------
+Animation PrintableFactory::buildAnimation(const std::string animationName, std::vector<Frame> frames,
+                                           const bool repeats, const size_t keyframeInterval)
+{
+   Animation animation = Animation(animationName, std::move(frames), repeats);
+   if (animation.getTotalFrames() == 1)
+   {
+      animation.setPlaying(false);
+   }
+   else if (keyframeInterval > 0)
+   {
+      animation.encodeDeltas(keyframeInterval);
+   }
+   return animation;
+}
+
+// private static --------------------------------------------------------------------------------------------
+std::vector<Animation> PrintableFactory::loadAnimations(const std::string directoryName, const bool repeats,
+                                                        const size_t keyframeInterval)
+{
+   std::string              basePath = "src/Animations/" + directoryName;
+   std::vector<std::string> animationNames;
+
+   // A current archive replaces the whole directory tree, it lists its animations in name order
+   AnimationArchive archive;
+   if (isArchiveCurrent(basePath) && archive.open(basePath + AnimationArchive::EXTENSION))
+   {
+      std::vector<Animation> animations;
+      for (const AnimationArchive::AnimationEntry& archived : archive.getAnimations())
+      {
+         std::vector<Frame> frames;
+         loadArchiveFrames(archive, archived, frames);
+         animations.push_back(buildAnimation(archived.name, std::move(frames), repeats, keyframeInterval));
+      }
+      return animations;
+   }
+
+   try
+   {
+      for (const auto& entry : fs::directory_iterator(basePath))
+      {
+         if (entry.is_directory())
+         {
+            animationNames.push_back(entry.path().filename().string());
+         }
+      }
+   }
+   catch (const fs::filesystem_error& e)
+   {
+      std::cerr << "Error loading animations for entity '" << directoryName << "': " << e.what() << std::endl;
+   }
+   std::sort(animationNames.begin(), animationNames.end());
+
+   // Gather the text frames of every animation into one list so they are all parsed in a single pass
+   std::vector<std::vector<Frame>>        animationFrames(animationNames.size());
+   std::vector<uint8_t>                   failed(animationNames.size(), 0);
+   std::vector<std::string>               textFrameFiles;
+   std::vector<std::pair<size_t, size_t>> textFrameSlots; // Animation index, frame index
+   std::vector<std::vector<char>>         sheetBuffers(animationNames.size());
+   std::vector<std::string_view>          sheetFrames;
+   std::vector<std::pair<size_t, size_t>> sheetFrameSlots;
+   for (size_t i = 0; i < animationNames.size(); i++)
+   {
+      std::string                   folderPath = basePath + "/" + animationNames[i];
+      std::vector<std::string_view> frameTexts;
+      try
+      {
+         std::vector<fs::directory_entry> entries = getTextFrameFiles(folderPath);
+         if (loadCompiledFrames(folderPath, entries, animationFrames[i]))
+            continue;
+
+         if (AnimationSheet::read(folderPath + "/" + AnimationSheet::FILE_NAME, sheetBuffers[i], frameTexts))
+         {
+            animationFrames[i].resize(frameTexts.size());
+            for (size_t j = 0; j < frameTexts.size(); j++)
+            {
+               sheetFrames.push_back(frameTexts[j]);
+               sheetFrameSlots.emplace_back(i, j);
+            }
+         }
+         else
+         {
+            animationFrames[i].resize(entries.size());
+            for (size_t j = 0; j < entries.size(); j++)
+            {
+               textFrameFiles.push_back(entries[j].path().string());
+               textFrameSlots.emplace_back(i, j);
+            }
+         }
+      }
+      catch (const fs::filesystem_error& e)
+      {
+         std::cerr << "Filesystem error: " << e.what() << std::endl;
+         failed[i] = 1;
+      }
+   }
+
+   // Sheet records come after the text frame files in the same index range
+   ThreadPool& loaderPool = ThreadPool::getLoaderPool();
+   loaderPool.parallelFor(textFrameFiles.size() + sheetFrames.size(),
+                          [&](size_t i)
+                          {
+                             if (i < textFrameFiles.size())
+                             {
+                                const auto& slot  = textFrameSlots[i];
+                                Frame&      frame = animationFrames[slot.first][slot.second];
+                                frame             = getFrameFromTextFile(textFrameFiles[i]);
+                             }
+                             else
+                             {
+                                const auto& slot  = sheetFrameSlots[i - textFrameFiles.size()];
+                                Frame&      frame = animationFrames[slot.first][slot.second];
+                                frame             = parseTextFrame(sheetFrames[i - textFrameFiles.size()]);
+                             }
+                          });
+
+   std::vector<Animation> animations(animationNames.size());
+   loaderPool.parallelFor(animationNames.size(),
+                          [&](size_t i)
+                          {
+                             if (!failed[i])
+                             {
+                                animations[i] = buildAnimation(animationNames[i],
+                                                               std::move(animationFrames[i]), repeats,
+                                                               keyframeInterval);
+                             }
+                          });
+   return animations;
+}
+
+// private static --------------------------------------------------------------------------------------------
+void PrintableFactory::addPendingLoad(std::function<bool()> poll)
+{
+   pendingLoads.push_back(std::move(poll));
+}
+
+// private static --------------------------------------------------------------------------------------------
+void PrintableFactory::addToWindow(const std::shared_ptr<Printable>& printable,
+                                   std::shared_ptr<NcursesWindow>    ncursesWindow,
+                                   const std::string                 description)
+{
+   if (ncursesWindow == nullptr && !ncursesWindows.empty())
+      ncursesWindow = ncursesWindows.at(0);
+
+   if (ncursesWindow == nullptr)
    {
-      std::cerr << "Warning: No ncurses windows available for entity '" << entityName << "'" << std::endl;
+      std::cerr << "Warning: No ncurses windows available for " << description << std::endl;
+      return;
    }
+
+   printable->setNcurseWindow(ncursesWindow->getWindow());
+   ncursesWindow->addPrintable(printable);
+   ncursesWindow->setPrintablesNeedSorted(true);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+std::shared_ptr<Entity> PrintableFactory::loadEntity(const std::string entityName, bool visable,
+                                                     bool                           moveableByCamera,
+                                                     std::shared_ptr<NcursesWindow> ncursesWindow,
+                                                     const size_t                   keyframeInterval)
+{
+   std::vector<Animation> animations = loadAnimations(entityName, true, keyframeInterval);
+   auto entity = std::make_shared<Entity>(entityName, animations, visable, moveableByCamera);
+   addToWindow(entity, ncursesWindow, "entity '" + entityName + "'");
    return entity;
 }
 
@@ -257,42 +1178,9 @@ std::shared_ptr<UIElement> PrintableFactory::loadUIElement(const std::string dir
                                                            std::shared_ptr<NcursesWindow> ncursesWindow)
 
 {
-   std::vector<Animation> animations;
-   std::string            basePath = "src/Animations/" + directoryName;
-
-   try
-   {
-      for (const auto& entry : fs::directory_iterator(basePath))
-      {
-         if (entry.is_directory())
-         {
-            std::string animationName = entry.path().filename().string();
-            Animation   anim          = loadAnimation(directoryName, animationName, true);
-            animations.push_back(anim);
-         }
-      }
-   }
-   catch (const fs::filesystem_error& e)
-   {
-      std::cerr << "Error loading animations for entity '" << directoryName << "': " << e.what() << std::endl;
-   }
+   std::vector<Animation> animations = loadAnimations(directoryName, true, 0);
    auto uiElement = std::make_shared<UIElement>(directoryName, animations, visable, moveableByCamera);
-   if (ncursesWindow != nullptr)
-   {
-      uiElement->setNcurseWindow(ncursesWindow->getWindow());
-      ncursesWindow->addPrintable(uiElement);
-      ncursesWindow->setPrintablesNeedSorted(true);
-   }
-   else if (!ncursesWindows.empty())
-   {
-      uiElement->setNcurseWindow(ncursesWindows.at(0)->getWindow());
-      ncursesWindows.at(0)->addPrintable(uiElement);
-      ncursesWindows.at(0)->setPrintablesNeedSorted(true);
-   }
-   else
-   {
-      std::cerr << "Warning: No ncurses windows available for UIElement '" << directoryName << "'" << std::endl;
-   }
+   addToWindow(uiElement, ncursesWindow, "UIElement '" + directoryName + "'");
    return uiElement;
 };
 
@@ -301,42 +1189,9 @@ std::shared_ptr<Button>
 PrintableFactory::loadButton(const std::string directoryName, const bool visable, const bool moveableByCamera,
                              std::function<void()> function, std::shared_ptr<NcursesWindow> ncursesWindow)
 {
-   std::vector<Animation> animations;
-   std::string            basePath = "src/Animations/" + directoryName;
-
-   try
-   {
-      for (const auto& entry : fs::directory_iterator(basePath))
-      {
-         if (entry.is_directory())
-         {
-            std::string animationName = entry.path().filename().string();
-            Animation   anim          = loadAnimation(directoryName, animationName, true);
-            animations.push_back(anim);
-         }
-      }
-   }
-   catch (const fs::filesystem_error& e)
-   {
-      std::cerr << "Error loading animations for entity '" << directoryName << "': " << e.what() << std::endl;
-   }
+   std::vector<Animation> animations = loadAnimations(directoryName, true, 0);
    auto button = std::make_shared<Button>(directoryName, animations, visable, moveableByCamera, function);
-   if (ncursesWindow != nullptr)
-   {
-      button->setNcurseWindow(ncursesWindow->getWindow());
-      ncursesWindow->addPrintable(button);
-      ncursesWindow->setPrintablesNeedSorted(true);
-   }
-   else if (!ncursesWindows.empty())
-   {
-      button->setNcurseWindow(ncursesWindows.at(0)->getWindow());
-      ncursesWindows.at(0)->addPrintable(button);
-      ncursesWindows.at(0)->setPrintablesNeedSorted(true);
-   }
-   else
-   {
-      std::cerr << "Warning: No ncurses windows available for Button '" << directoryName << "'" << std::endl;
-   }
+   addToWindow(button, ncursesWindow, "Button '" + directoryName + "'");
 
    // Automatically register with global InputHandler
    globalInputHandler.addButton(button);
@@ -344,6 +1199,88 @@ PrintableFactory::loadButton(const std::string directoryName, const bool visable
    return button;
 }
 
+// public static ---------------------------------------------------------------------------------------------
+std::shared_ptr<AsyncLoad<Entity>>
+PrintableFactory::loadEntityAsync(const std::string entityName, const bool visable,
+                                  const bool moveableByCamera, std::shared_ptr<NcursesWindow> ncursesWindow,
+                                  const size_t keyframeInterval, AsyncLoad<Entity>::OnLoaded onLoaded)
+{
+   return startLoad<Entity>(
+       entityName, keyframeInterval,
+       [entityName, visable, moveableByCamera, ncursesWindow](std::vector<Animation> animations)
+       {
+          auto entity = std::make_shared<Entity>(entityName, animations, visable, moveableByCamera);
+          addToWindow(entity, ncursesWindow, "entity '" + entityName + "'");
+          return entity;
+       },
+       std::move(onLoaded));
+}
+
+// public static ---------------------------------------------------------------------------------------------
+std::shared_ptr<AsyncLoad<UIElement>>
+PrintableFactory::loadUIElementAsync(const std::string directoryName, const bool visable,
+                                     const bool                     moveableByCamera,
+                                     std::shared_ptr<NcursesWindow> ncursesWindow,
+                                     AsyncLoad<UIElement>::OnLoaded onLoaded)
+{
+   return startLoad<UIElement>(
+       directoryName, 0,
+       [directoryName, visable, moveableByCamera, ncursesWindow](std::vector<Animation> animations)
+       {
+          auto uiElement = std::make_shared<UIElement>(directoryName, animations, visable, moveableByCamera);
+          addToWindow(uiElement, ncursesWindow, "UIElement '" + directoryName + "'");
+          return uiElement;
+       },
+       std::move(onLoaded));
+}
+
+// public static ---------------------------------------------------------------------------------------------
+std::shared_ptr<AsyncLoad<Button>>
+PrintableFactory::loadButtonAsync(const std::string directoryName, const bool visable,
+                                  const bool moveableByCamera, std::function<void()> function,
+                                  std::shared_ptr<NcursesWindow> ncursesWindow,
+                                  AsyncLoad<Button>::OnLoaded    onLoaded)
+{
+   return startLoad<Button>(
+       directoryName, 0,
+       [directoryName, visable, moveableByCamera, function, ncursesWindow](std::vector<Animation> animations)
+       {
+          auto button =
+              std::make_shared<Button>(directoryName, animations, visable, moveableByCamera, function);
+          addToWindow(button, ncursesWindow, "Button '" + directoryName + "'");
+          globalInputHandler.addButton(button);
+          return button;
+       },
+       std::move(onLoaded));
+}
+
+// public static ---------------------------------------------------------------------------------------------
+void PrintableFactory::completePendingLoads()
+{
+   // Completion callbacks may start new loads, which land in pendingLoads while the current batch is polled
+   std::vector<std::function<bool()>> polling;
+   polling.swap(pendingLoads);
+
+   std::vector<std::function<bool()>> stillLoading;
+   for (std::function<bool()>& poll : polling)
+   {
+      if (!poll())
+         stillLoading.push_back(std::move(poll));
+   }
+
+   for (std::function<bool()>& poll : pendingLoads)
+   {
+      stillLoading.push_back(std::move(poll));
+   }
+   pendingLoads.swap(stillLoading);
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool PrintableFactory::hasPendingLoads()
+{
+   return !pendingLoads.empty();
+}
+
 // public static ---------------------------------------------------------------------------------------------
 std::shared_ptr<Button> PrintableFactory::newButton(std::string text, std::function<void()> function,
                                                     std::shared_ptr<NcursesWindow> ncursesWindow)
@@ -484,8 +1421,253 @@ std::shared_ptr<Button> PrintableFactory::newButton(std::string
    return button;
 }
 
+// private static --------------------------------------------------------------------------------------------
+static uint64_t styleKey(const RGB& color)
+{
+   // ncurses colors are 0 - 1000, 21 bits per channel is plenty
+   return (static_cast<uint64_t>(color.getR() & 0x1FFFFF) << 42) |
+          (static_cast<uint64_t>(color.getG() & 0x1FFFFF) << 21) |
+          static_cast<uint64_t>(color.getB() & 0x1FFFFF);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static uint64_t styleKey(const attr_t attr)
+{
+   return attr;
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendInt(std::string& text, const long value)
+{
+   char  digits[24];
+   char* digitsEnd = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+   text.append(digits, digitsEnd);
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendStyle(std::string& text, const RGB& color)
+{
+   appendInt(text, color.getR());
+   text += ',';
+   appendInt(text, color.getG());
+   text += ',';
+   appendInt(text, color.getB());
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendStyle(std::string& text, const attr_t attr)
+{
+   appendInt(text, static_cast<int>(attr));
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void appendUtf8(std::string& text, const wchar_t character)
+{
+   uint32_t codePoint = static_cast<uint32_t>(character);
+   if (codePoint < 0x80)
+   {
+      text += static_cast<char>(codePoint);
+   }
+   else if (codePoint < 0x800)
+   {
+      text += static_cast<char>(0xC0 | (codePoint >> 6));
+      text += static_cast<char>(0x80 | (codePoint & 0x3F));
+   }
+   else if (codePoint < 0x10000)
+   {
+      text += static_cast<char>(0xE0 | (codePoint >> 12));
+      text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      text += static_cast<char>(0x80 | (codePoint & 0x3F));
+   }
+   else if (codePoint < 0x110000)
+   {
+      text += static_cast<char>(0xF0 | (codePoint >> 18));
+      text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+      text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      text += static_cast<char>(0x80 | (codePoint & 0x3F));
+   }
+   else
+   {
+      text += "\xEF\xBF\xBD"; // Not a code point, replacement character
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+template <typename T> static T mostCommonStyle(const std::vector<T>& cells, const T& fallback)
+{
+   std::unordered_map<uint64_t, size_t> counts;
+   T                                    best      = fallback;
+   size_t                               bestCount = 0;
+   for (const T& style : cells)
+   {
+      size_t count = ++counts[styleKey(style)];
+      if (count > bestCount)
+      {
+         best      = style;
+         bestCount = count;
+      }
+   }
+   return best;
+}
+
+// private static --------------------------------------------------------------------------------------------
+template <typename T>
+static size_t appendStyleRuns(std::string& text, const char tag, const std::vector<T>& cells, const int width,
+                              const T& base)
+{
+   size_t   runCount = 0;
+   uint64_t baseKey  = styleKey(base);
+   for (size_t y = 0; y * width < cells.size(); ++y)
+   {
+      const T* row = cells.data() + y * width;
+      int      x   = 0;
+      while (x < width)
+      {
+         uint64_t key = styleKey(row[x]);
+         if (key == baseKey)
+         {
+            ++x;
+            continue;
+         }
+
+         int start = x;
+         while (x < width && styleKey(row[x]) == key)
+            ++x;
+         text += tag;
+         text += ' ';
+         appendInt(text, y);
+         text += ' ';
+         appendInt(text, start);
+         text += ' ';
+         appendInt(text, x - start);
+         text += ' ';
+         appendStyle(text, row[start]);
+         text += '\n';
+         ++runCount;
+      }
+   }
+   return runCount;
+}
+
+// private static --------------------------------------------------------------------------------------------
+template <typename T>
+static void appendStyleRows(std::string& text, const std::vector<T>& cells, const int width)
+{
+   for (size_t cell = 0; cell < cells.size(); ++cell)
+   {
+      appendStyle(text, cells[cell]);
+      text += (cell + 1) % width == 0 ? '\n' : ' ';
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static void serializeFrame(const Frame& frame, std::string& text)
+{
+   const Sprite& sprite = frame.getSprite();
+   const auto&   pixels = sprite.getPixels();
+
+   // Find max X and Y for frame size
+   int maxX = 0, maxY = 0;
+   for (const auto& pixel : pixels)
+   {
+      maxX = std::max(maxX, pixel.getPosition().getX());
+      maxY = std::max(maxY, pixel.getPosition().getY());
+   }
+
+   // One entry per cell row major, cells without a pixel are blank white on black
+   int                  width     = maxX + 1;
+   int                  height    = maxY + 1;
+   size_t               cellCount = static_cast<size_t>(width) * height;
+   std::vector<wchar_t> characters(cellCount, L' ');
+   std::vector<RGB>     textRGBs(cellCount, RGB(1000, 1000, 1000));
+   std::vector<RGB>     bgRGBs(cellCount, RGB(0, 0, 0));
+   std::vector<attr_t>  attrs(cellCount, A_NORMAL);
+   for (const auto& pixel : pixels)
+   {
+      int x = pixel.getPosition().getX();
+      int y = pixel.getPosition().getY();
+      if (x >= 0 && y >= 0)
+      {
+         size_t cell      = static_cast<size_t>(y) * width + x;
+         characters[cell] = pixel.getCharacter();
+         textRGBs[cell]   = pixel.getTextColor();
+         bgRGBs[cell]     = pixel.getBackgroundColor();
+         attrs[cell]      = pixel.getAttributes();
+      }
+   }
+
+   // Room for the art and a few style runs, the dense sections grow it as needed
+   text.clear();
+   text.reserve(cellCount + height + 128);
+
+   // Write duration and layer as first line. to_chars ignores the locale, snprintf would write 0,5 where
+   // the decimal separator is a comma and parseFrameHeader would read that as duration 0 and layer 5.
+   char  duration[32];
+   char* durationEnd = std::to_chars(duration, duration + sizeof(duration), frame.getDuration()).ptr;
+   text.append(duration, durationEnd);
+   text += ',';
+   appendInt(text, sprite.getLayer());
+   text += '\n';
+
+   // Write sprite lines
+   for (size_t cell = 0; cell < cellCount; ++cell)
+   {
+      appendUtf8(text, characters[cell]);
+      if ((cell + 1) % width == 0)
+         text += '\n';
+   }
+
+   // Styles are written sparse, a default per section plus the runs of cells that differ from it, unless so
+   // many cells differ that the full grids are about as small
+   RGB         textDefault = mostCommonStyle(textRGBs, RGB(1000, 1000, 1000));
+   RGB         bgDefault   = mostCommonStyle(bgRGBs, RGB(0, 0, 0));
+   attr_t      attrDefault = mostCommonStyle(attrs, static_cast<attr_t>(A_NORMAL));
+   std::string styleRuns;
+   size_t      styleRunCount = appendStyleRuns(styleRuns, 't', textRGBs, width, textDefault) +
+                               appendStyleRuns(styleRuns, 'b', bgRGBs, width, bgDefault) +
+                               appendStyleRuns(styleRuns, 'a', attrs, width, attrDefault);
+   if (styleRunCount * 2 <= cellCount)
+   {
+      text += "---sparse\ndefault ";
+      appendStyle(text, textDefault);
+      text += ' ';
+      appendStyle(text, bgDefault);
+      text += ' ';
+      appendStyle(text, attrDefault);
+      text += '\n';
+      text += styleRuns;
+   }
+   else
+   {
+      text += "---\n";
+      appendStyleRows(text, textRGBs, width);
+      appendStyleRows(text, bgRGBs, width);
+      appendStyleRows(text, attrs, width);
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+static bool writeFileAtomically(const std::string fileLocation, const std::string& contents)
+{
+   // Written beside the target and renamed over it, an interrupted save leaves the old file intact
+   std::string   temporaryLocation = fileLocation + ".tmp";
+   std::ofstream out(temporaryLocation, std::ios::trunc | std::ios::binary);
+   if (!out.is_open())
+      return false;
+
+   out.write(contents.data(), contents.size());
+   out.close();
+   if (!out || std::rename(temporaryLocation.c_str(), fileLocation.c_str()) != 0)
+   {
+      std::remove(temporaryLocation.c_str());
+      return false;
+   }
+   return true;
+}
+
 // public static ---------------------------------------------------------------------------------------------
-void PrintableFactory::writePrintableToTextFiles(const std::shared_ptr<Printable>& printable)
+void PrintableFactory::writePrintableToTextFiles(const std::shared_ptr<Printable>& printable,
+                                                 const bool                        asSheet)
 {
    namespace fs = std::filesystem;
    if (!printable)
@@ -494,100 +1676,227 @@ void PrintableFactory::writePrintableToTextFiles(const std::shared_ptr<Printable
    std::string baseDir = "src/Animations/" + printable->getPrintableName();
    fs::create_directories(baseDir);
 
+   ThreadPool& loaderPool = ThreadPool::getLoaderPool();
    const auto& animations = printable->getAnimations();
-   for (const auto& animation : animations)
+   for (const auto& storedAnimation : animations)
    {
-      std::string animationDir = baseDir + "/" + animation.getAnimationName();
-      fs::create_directories(animationDir);
+      // Streamed animations only hold frame headers, writing them would wipe the frame files
+      if (storedAnimation.getStream())
+      {
+         std::cerr << "Not writing streamed animation: " << storedAnimation.getAnimationName() << std::endl;
+         continue;
+      }
 
-      const auto& frames = animation.getFrames();
-      for (size_t i = 0; i < frames.size(); ++i)
+      Animation animation = storedAnimation;
+      if (animation.isDeltaEncoded())
       {
-         const auto&   frame  = frames[i];
-         const Sprite& sprite = frame.getSprite();
-         const auto&   pixels = sprite.getPixels();
+         animation.decodeDeltas();
+      }
 
-         // Find max X and Y for frame size
-         int maxX = 0, maxY = 0;
-         for (const auto& pixel : pixels)
-         {
-            int x = pixel.getPosition().getX();
-            int y = pixel.getPosition().getY();
-            if (x > maxX)
-               maxX = x;
-            if (y > maxY)
-               maxY = y;
-         }
+      std::string animationDir = baseDir + "/" + animation.getAnimationName();
+      std::string sheetPath    = animationDir + "/" + AnimationSheet::FILE_NAME;
+      fs::create_directories(animationDir);
 
-         // Prepare 2D arrays for output
-         std::vector<std::string>      asciiLines(maxY + 1, std::string(maxX + 1, ' '));
-         std::vector<std::vector<RGB>> textRGBs(maxY + 1, std::vector<RGB>(maxX + 1, RGB(1000, 1000, 1000)));
-         std::vector<std::vector<RGB>> bgRGBs(maxY + 1, std::vector<RGB>(maxX + 1, RGB(0, 0, 0)));
-         std::vector<std::vector<attr_t>> attrs(maxY + 1, std::vector<attr_t>(maxX + 1, A_NORMAL));
-         for (const auto& pixel : pixels)
+      // Hashes of what is on disk, from the current manifest or the sheet, so unchanged frames are skipped
+      std::unordered_map<std::string, uint64_t> savedHashes;
+      std::vector<uint64_t>                     savedSheetHashes;
+      if (asSheet)
+      {
+         std::vector<char>             sheetBuffer;
+         std::vector<std::string_view> savedFrames;
+         if (AnimationSheet::read(sheetPath, sheetBuffer, savedFrames))
          {
-            int x = pixel.getPosition().getX();
-            int y = pixel.getPosition().getY();
-            if (y >= 0 && y < (int)asciiLines.size() && x >= 0 && x < (int)asciiLines[y].size())
+            for (const std::string_view savedFrame : savedFrames)
             {
-               asciiLines[y][x] = pixel.getCharacter();
-               textRGBs[y][x]   = pixel.getTextColor();
-               bgRGBs[y][x]     = pixel.getBackgroundColor();
-               attrs[y][x]      = pixel.getAttributes();
+               savedSheetHashes.push_back(AnimationManifest::hash(savedFrame.data(), savedFrame.size()));
             }
          }
-
-         // Write to file
-         std::string   frameFile = animationDir + "/frame" + std::to_string(i) + ".txt";
-         std::ofstream out(frameFile, std::ios::trunc);
-         if (!out.is_open())
+      }
+      else
+      {
+         AnimationManifest saved;
+         try
          {
-            std::cerr << "Failed to write frame file: " << frameFile << std::endl;
-            continue;
+            getTextFrameFiles(animationDir, &saved);
          }
-         // Write duration and layer as first line
-         out << frame.getDuration() << "," << sprite.getLayer() << "\n";
-         // Write sprite lines
-         for (const auto& line : asciiLines)
-            out << line << "\n";
-         // Write delimiter
-         out << "---\n";
-         // Write text RGB lines
-         for (const auto& row : textRGBs)
+         catch (const fs::filesystem_error& e)
          {
-            for (size_t x = 0; x < row.size(); ++x)
-            {
-               out << row[x].getR() << "," << row[x].getG() << "," << row[x].getB();
-               if (x < row.size() - 1)
-                  out << " ";
-            }
-            out << "\n";
+            std::cerr << "Filesystem error: " << e.what() << std::endl;
          }
-         // Write background RGB lines
-         for (const auto& row : bgRGBs)
+         for (const AnimationManifest::FrameInfo& info : saved.getFrames())
          {
-            for (size_t x = 0; x < row.size(); ++x)
+            savedHashes[info.fileName] = info.hash;
+         }
+      }
+
+      // Frames are serialized, hashed and written concurrently, each into its own slot
+      const auto&                               frames = animation.getFrames();
+      std::vector<std::string>                  frameTexts(frames.size());
+      std::vector<AnimationManifest::FrameInfo> frameInfos(frames.size());
+      std::vector<uint8_t>                      changed(frames.size(), 0);
+      std::vector<uint8_t>                      failed(frames.size(), 0);
+      loaderPool.parallelFor(
+            frames.size(),
+            [&](size_t i)
             {
-               out << row[x].getR() << "," << row[x].getG() << "," << row[x].getB();
-               if (x < row.size() - 1)
-                  out << " ";
-            }
-            out << "\n";
+               std::string& text = frameTexts[i];
+               serializeFrame(frames[i], text);
+               uint64_t textHash = AnimationManifest::hash(text.data(), text.size());
+               if (asSheet)
+               {
+                  changed[i] = i >= savedSheetHashes.size() || savedSheetHashes[i] != textHash;
+                  return;
+               }
+
+               std::string frameName = "frame" + std::to_string(i) + ".txt";
+               frameInfos[i]         = AnimationManifest::describeFrame(frameName, frames[i], textHash);
+               auto saved            = savedHashes.find(frameName);
+               changed[i]            = saved == savedHashes.end() || saved->second != textHash;
+               if (changed[i] && !writeFileAtomically(animationDir + "/" + frameName, text))
+               {
+                  std::cerr << "Failed to write frame file: " << animationDir + "/" + frameName << std::endl;
+                  failed[i] = 1;
+               }
+               text = std::string();
+            });
+
+      bool anyChanged = std::find(changed.begin(), changed.end(), 1) != changed.end();
+      bool anyFailed  = std::find(failed.begin(), failed.end(), 1) != failed.end();
+      if (asSheet)
+      {
+         anyChanged = anyChanged || savedSheetHashes.size() != frames.size();
+         if (anyChanged && !AnimationSheet::write(sheetPath, frameTexts))
+            continue;
+      }
+
+      // Frames left over from a longer version of the animation, or from before it became a sheet, would
+      // otherwise be loaded again
+      size_t          keptFrames = asSheet ? 0 : frames.size();
+      std::error_code removeError;
+      for (const auto& entry : fs::directory_iterator(animationDir))
+      {
+         std::string fileName = entry.path().filename().string();
+         if (fileName.size() > 9 && fileName.size() < 19 && fileName.compare(0, 5, "frame") == 0 &&
+             fileName.compare(fileName.size() - 4, 4, ".txt") == 0 &&
+             std::all_of(fileName.begin() + 5, fileName.end() - 4,
+                         [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }) &&
+             std::stoul(fileName.substr(5, fileName.size() - 9)) >= keptFrames)
+         {
+            fs::remove(entry.path(), removeError);
          }
-         // Write attribute lines
-         for (const auto& row : attrs)
+      }
+
+      // A directory holds either a sheet or frame files with their manifest, never both
+      std::string manifestPath = animationDir + "/" + AnimationManifest::FILE_NAME;
+      if (asSheet)
+      {
+         fs::remove(manifestPath, removeError);
+      }
+      else if (anyFailed)
+      {
+         // The manifest would vouch for frames that were not written
+         fs::remove(manifestPath, removeError);
+      }
+      else
+      {
+         fs::remove(sheetPath, removeError);
+         if (anyChanged || savedHashes.size() != frames.size())
          {
-            for (size_t x = 0; x < row.size(); ++x)
+            AnimationManifest manifest;
+            for (const AnimationManifest::FrameInfo& info : frameInfos)
             {
-               out << static_cast<int>(row[x]);
-               if (x < row.size() - 1)
-                  out << " ";
+               manifest.addFrame(info);
             }
-            out << "\n";
+            manifest.write(manifestPath);
+         }
+      }
+   }
+}
+
+// private static --------------------------------------------------------------------------------------------
+bool PrintableFactory::readFrameTexts(const std::string folderPath, std::vector<std::string>& frameTexts)
+{
+   frameTexts.clear();
+
+   std::vector<char>             sheetBuffer;
+   std::vector<std::string_view> sheetFrames;
+   if (AnimationSheet::read(folderPath + "/" + AnimationSheet::FILE_NAME, sheetBuffer, sheetFrames))
+   {
+      frameTexts.assign(sheetFrames.begin(), sheetFrames.end());
+      return true;
+   }
+
+   // Text frames are taken byte for byte, a directory with only a compiled file is serialized from it
+   std::vector<fs::directory_entry> entries = getTextFrameFiles(folderPath);
+   if (entries.empty())
+   {
+      AnimationFile animationFile(folderPath + "/" + AnimationFile::FILE_NAME);
+      frameTexts.resize(animationFile.getFrameCount());
+      for (size_t i = 0; i < animationFile.getFrameCount(); i++)
+      {
+         serializeFrame(animationFile.getFrame(i), frameTexts[i]);
+      }
+      return animationFile.isOpen();
+   }
+
+   frameTexts.resize(entries.size());
+   for (size_t i = 0; i < entries.size(); i++)
+   {
+      std::ifstream in(entries[i].path(), std::ios::binary);
+      frameTexts[i].assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+      if (!in.is_open())
+         return false;
+   }
+   return true;
+}
+
+// public static ---------------------------------------------------------------------------------------------
+bool PrintableFactory::writeArchive(const std::string entityFolderPath, const bool compress)
+{
+   std::vector<AnimationArchive::AnimationText> animations;
+   try
+   {
+      std::vector<std::string> animationNames;
+      for (const auto& entry : fs::directory_iterator(entityFolderPath))
+      {
+         if (entry.is_directory())
+         {
+            animationNames.push_back(entry.path().filename().string());
+         }
+      }
+      std::sort(animationNames.begin(), animationNames.end());
+
+      for (const std::string& animationName : animationNames)
+      {
+         std::vector<std::string> frameTexts;
+         if (!readFrameTexts(entityFolderPath + "/" + animationName, frameTexts))
+         {
+            std::cerr << "Failed to read frames of " << entityFolderPath + "/" + animationName << std::endl;
+            return false;
          }
-         out.close();
+
+         AnimationArchive::AnimationText animation;
+         animation.name = animationName;
+         for (std::string& frameText : frameTexts)
+         {
+            AnimationArchive::FrameText frame;
+            frame.duration = 1.0f;
+            frame.layer    = 0;
+            parseFrameHeader(std::string_view(frameText).substr(0, frameText.find('\n')), frame.duration,
+                             frame.layer);
+            frame.text = std::move(frameText);
+            animation.frames.push_back(std::move(frame));
+         }
+         animations.push_back(std::move(animation));
       }
    }
+   catch (const fs::filesystem_error& e)
+   {
+      std::cerr << "Filesystem error: " << e.what() << std::endl;
+      return false;
+   }
+
+   return AnimationArchive::write(entityFolderPath + AnimationArchive::EXTENSION, animations, compress);
 }
 
 // public static ---------------------------------------------------------------------------------------------
@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ThreadPool.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Implementation of ThreadPool class for background and parallel work
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/ThreadPool.h"
+#include "../../include/Parameters.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+// public ----------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(const size_t threadCount)
+{
+   m_stopping = false;
+   for (size_t i = 0; i < threadCount; i++)
+   {
+      m_workers.emplace_back(&ThreadPool::workerLoop, this);
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+   }
+   m_taskAvailable.notify_all();
+   for (std::thread& worker : m_workers)
+   {
+      worker.join();
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+void ThreadPool::parallelFor(const size_t count, const std::function<void(size_t)>& body)
+{
+   if (count == 0)
+      return;
+
+   // Shared with the helper tasks, which may start after this call has already returned
+   struct Progress
+   {
+      std::atomic<size_t>     next{0};
+      std::atomic<size_t>     completed{0};
+      std::mutex              mutex;
+      std::condition_variable done;
+      std::exception_ptr      error;
+   };
+   auto                               progress = std::make_shared<Progress>();
+   const std::function<void(size_t)>* function = &body;
+
+   // body is only called for indexes below count, so a late helper returns without touching it
+   auto work = [progress, function, count]()
+   {
+      for (size_t index = progress->next++; index < count; index = progress->next++)
+      {
+         try
+         {
+            (*function)(index);
+         }
+         catch (...)
+         {
+            std::lock_guard<std::mutex> lock(progress->mutex);
+            if (!progress->error)
+               progress->error = std::current_exception();
+         }
+
+         if (++progress->completed == count)
+         {
+            std::lock_guard<std::mutex> lock(progress->mutex);
+            progress->done.notify_all();
+         }
+      }
+   };
+
+   size_t helpers = std::min(m_workers.size(), count - 1);
+   for (size_t i = 0; i < helpers; i++)
+   {
+      enqueue(work);
+   }
+   work();
+
+   std::unique_lock<std::mutex> lock(progress->mutex);
+   progress->done.wait(lock, [&progress, count]() { return progress->completed == count; });
+   if (progress->error)
+   {
+      std::rethrow_exception(progress->error);
+   }
+};
+
+// public ----------------------------------------------------------------------------------------------------
+size_t ThreadPool::getThreadCount() const
+{
+   return m_workers.size();
+};
+
+// public static ---------------------------------------------------------------------------------------------
+ThreadPool& ThreadPool::getLoaderPool()
+{
+   static ThreadPool loaderPool(
+         std::max(1u, std::min(maxLoaderThreads, std::max(1u, std::thread::hardware_concurrency()))));
+   return loaderPool;
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void ThreadPool::workerLoop()
+{
+   while (true)
+   {
+      std::function<void()> task;
+      {
+         std::unique_lock<std::mutex> lock(m_mutex);
+         m_taskAvailable.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+         if (m_stopping && m_tasks.empty())
+            return;
+
+         task = std::move(m_tasks.front());
+         m_tasks.pop_front();
+      }
+      task();
+   }
+};
+
+// private ---------------------------------------------------------------------------------------------------
+void ThreadPool::enqueue(std::function<void()> task)
+{
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(std::move(task));
+   }
+   m_taskAvailable.notify_one();
+};
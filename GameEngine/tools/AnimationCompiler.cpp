@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file AnimationCompiler.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Command line tool that indexes and compiles text animation trees into binary AnimationFiles
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/PrintableFactory.h"
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Usage: animationcompiler [--pack] [animationsRoot...]
+///
+/// Every root is laid out like src/Animations (root/entity/animation/frame files). Each animation directory
+/// gets its AnimationManifest and compiled file written next to its text frames. With --pack every entity is
+/// also packed into root/entity.pack (see AnimationArchive) for shipping. The root defaults to
+/// src/Animations.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+   std::vector<std::string> roots;
+   bool                     pack = false;
+   for (int i = 1; i < argc; i++)
+   {
+      if (std::string(argv[i]) == "--pack")
+      {
+         pack = true;
+         continue;
+      }
+      roots.push_back(argv[i]);
+   }
+   if (roots.empty())
+   {
+      roots.push_back("src/Animations");
+   }
+
+   int compiled = 0;
+   int packed   = 0;
+   int failed   = 0;
+   for (const std::string& root : roots)
+   {
+      try
+      {
+         for (const auto& entity : fs::directory_iterator(root))
+         {
+            if (!entity.is_directory())
+               continue;
+
+            for (const auto& animation : fs::directory_iterator(entity.path()))
+            {
+               if (!animation.is_directory())
+                  continue;
+
+               if (PrintableFactory::writeManifest(animation.path().string()) &&
+                   PrintableFactory::compileAnimation(animation.path().string()))
+               {
+                  compiled++;
+               }
+               else
+               {
+                  std::cerr << "Failed to compile " << animation.path().string() << std::endl;
+                  failed++;
+               }
+            }
+
+            // Packed last so the archive is newer than everything written into the directory above
+            if (pack && PrintableFactory::writeArchive(entity.path().string()))
+            {
+               packed++;
+            }
+            else if (pack)
+            {
+               std::cerr << "Failed to pack " << entity.path().string() << std::endl;
+               failed++;
+            }
+         }
+      }
+      catch (const fs::filesystem_error& e)
+      {
+         std::cerr << "Filesystem error: " << e.what() << std::endl;
+         failed++;
+      }
+   }
+
+   std::cout << "Compiled " << compiled << " animations";
+   if (pack)
+   {
+      std::cout << ", packed " << packed << " entities";
+   }
+   if (failed > 0)
+   {
+      std::cout << ", " << failed << " failed";
+   }
+   std::cout << std::endl;
+   return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,351 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file FrameParserBenchmark.cpp
+/// @author Nicholas Witulski (nicwitulski@gmail.com)
+/// @brief Command line tool that compares getFrameFromTextFile against the previous stream based parser
+/// @version 0.1
+/// @date 2025-10-18
+///
+/// @copyright Copyright (c) 2025
+///
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/AnimationManifest.h"
+#include "../include/AnimationSheet.h"
+#include "../include/PrintableFactory.h"
+#include <algorithm>
+#include <chrono>
+#include <codecvt>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @fn referenceGetFrameFromTextFile
+///
+/// The stream based parser getFrameFromTextFile replaced, kept as the baseline. It only reads the dense
+/// style sections.
+///
+/// @param fileLocation - Path to the text file to load
+/// @return Frame loaded from the text file
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static Frame referenceGetFrameFromTextFile(const std::string fileLocation)
+{
+   std::ifstream inputFile(fileLocation);
+
+   if (!inputFile.is_open())
+   {
+      std::cerr << "Error opening the file: " << fileLocation << std::endl;
+      std::vector<Pixel> errorPixels;
+      errorPixels.push_back(Pixel(Position(0, 0), '~'));
+      return Frame(Sprite(errorPixels), 1.0f);
+   }
+
+   std::string        line;
+   std::vector<Pixel> pixels;
+
+   // Parse first line to get frame duration and sprite layer
+   getline(inputFile, line);
+   std::stringstream ss(line);
+   std::string       value;
+   float             duration = 1.0f;
+   int               layer    = 0;
+
+   if (getline(ss, value, ','))
+   {
+      duration = std::stof(value);
+   }
+   if (getline(ss, value, ','))
+   {
+      layer = std::stoi(value);
+   }
+
+   // Read ASCII art lines until delimiter '---' or end of file
+   std::vector<std::string> asciiLines;
+   bool                     foundDelimiter = false;
+   while (getline(inputFile, line))
+   {
+      if (line == "---")
+      {
+         foundDelimiter = true;
+         break;
+      }
+      asciiLines.push_back(line);
+   }
+
+   int height = asciiLines.size();
+   int width  = 0;
+   for (const auto& l : asciiLines)
+      if ((int)l.size() > width)
+         width = l.size();
+
+   // Default color values (white text, black background, normal attributes)
+   std::vector<std::vector<RGB>>    textRGBs(height, std::vector<RGB>(width, RGB(1000, 1000, 1000)));
+   std::vector<std::vector<RGB>>    bgRGBs(height, std::vector<RGB>(width, RGB(0, 0, 0)));
+   std::vector<std::vector<attr_t>> attrs(height, std::vector<attr_t>(width, A_NORMAL));
+
+   // Only read color/attribute data if delimiter was found
+   if (foundDelimiter)
+   {
+      // Read text RGB lines
+      for (int y = 0; y < height; ++y)
+      {
+         if (!getline(inputFile, line))
+            break;
+         std::stringstream ss(line);
+         for (int x = 0; x < width; ++x)
+         {
+            std::string pixelStr;
+            if (!(ss >> pixelStr))
+               break;
+            int    r = 1000, g = 1000, b = 1000;
+            size_t p1 = pixelStr.find(',');
+            size_t p2 = pixelStr.find(',', p1 + 1);
+            if (p1 != std::string::npos && p2 != std::string::npos)
+            {
+               r = std::stoi(pixelStr.substr(0, p1));
+               g = std::stoi(pixelStr.substr(p1 + 1, p2 - p1 - 1));
+               b = std::stoi(pixelStr.substr(p2 + 1));
+            }
+            textRGBs[y][x] = RGB(r, g, b);
+         }
+      }
+
+      // Read background RGB lines
+      for (int y = 0; y < height; ++y)
+      {
+         if (!getline(inputFile, line))
+            break;
+         std::stringstream ss(line);
+         for (int x = 0; x < width; ++x)
+         {
+            std::string pixelStr;
+            if (!(ss >> pixelStr))
+               break;
+            int    r = 0, g = 0, b = 0;
+            size_t p1 = pixelStr.find(',');
+            size_t p2 = pixelStr.find(',', p1 + 1);
+            if (p1 != std::string::npos && p2 != std::string::npos)
+            {
+               r = std::stoi(pixelStr.substr(0, p1));
+               g = std::stoi(pixelStr.substr(p1 + 1, p2 - p1 - 1));
+               b = std::stoi(pixelStr.substr(p2 + 1));
+            }
+            bgRGBs[y][x] = RGB(r, g, b);
+         }
+      }
+
+      // Read attribute lines
+      for (int y = 0; y < height; ++y)
+      {
+         if (!getline(inputFile, line))
+            break;
+         std::stringstream ss(line);
+         for (int x = 0; x < width; ++x)
+         {
+            int attr = 0;
+            if (!(ss >> attr))
+               break;
+            attrs[y][x] = static_cast<attr_t>(attr);
+         }
+      }
+   }
+
+   // Compose pixels
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+   std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+#pragma GCC diagnostic pop
+   for (int y = 0; y < height; ++y)
+   {
+      std::wstring wline = converter.from_bytes(asciiLines[y]);
+      for (int x = 0; x < (int)wline.size(); ++x)
+      {
+         wchar_t ch        = wline[x];
+         RGB     textColor = textRGBs[y][x];
+         RGB     bgColor   = bgRGBs[y][x];
+         attr_t  attr      = attrs[y][x];
+         pixels.push_back(Pixel(Position(x, y), ch, textColor, bgColor, attr));
+      }
+   }
+   Sprite sprite   = Sprite(pixels, layer);
+   Frame  newFrame = Frame(sprite, duration);
+   inputFile.close();
+   return newFrame;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @fn sameFrames
+///
+/// @param a - Frame from one parser
+/// @param b - Frame from the other parser
+/// @return True if both frames have the same duration, layer and pixels
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool sameFrames(const Frame& a, const Frame& b)
+{
+   const std::vector<Pixel>& pixelsA = a.getSprite().getPixels();
+   const std::vector<Pixel>& pixelsB = b.getSprite().getPixels();
+   if (a.getDuration() != b.getDuration() || a.getSprite().getLayer() != b.getSprite().getLayer() ||
+       pixelsA.size() != pixelsB.size())
+   {
+      return false;
+   }
+
+   for (size_t i = 0; i < pixelsA.size(); i++)
+   {
+      const Pixel& pa = pixelsA[i];
+      const Pixel& pb = pixelsB[i];
+      if (pa.getPosition().getX() != pb.getPosition().getX() ||
+          pa.getPosition().getY() != pb.getPosition().getY() || pa.getCharacter() != pb.getCharacter() ||
+          pa.getTextColor().getR() != pb.getTextColor().getR() ||
+          pa.getTextColor().getG() != pb.getTextColor().getG() ||
+          pa.getTextColor().getB() != pb.getTextColor().getB() ||
+          pa.getBackgroundColor().getR() != pb.getBackgroundColor().getR() ||
+          pa.getBackgroundColor().getG() != pb.getBackgroundColor().getG() ||
+          pa.getBackgroundColor().getB() != pb.getBackgroundColor().getB() ||
+          pa.getAttributes() != pb.getAttributes())
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @fn isSparseFrame
+///
+/// @param fileLocation - Path to a text frame
+/// @return True if the frame uses the sparse style sections, which the reference parser cannot read
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool isSparseFrame(const std::string& fileLocation)
+{
+   std::ifstream inputFile(fileLocation);
+   std::string   line;
+   while (getline(inputFile, line))
+   {
+      if (line == "---sparse")
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @fn microsecondsPerFile
+///
+/// @param files - Text frames to parse
+/// @param iterations - Times every file is parsed
+/// @param parse - Parser to time
+/// @return Average time of one parse in microseconds
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static double microsecondsPerFile(const std::vector<std::string>& files, const int iterations,
+                                  Frame (*parse)(const std::string))
+{
+   size_t pixels = 0;
+   auto   start  = std::chrono::steady_clock::now();
+   for (int i = 0; i < iterations; i++)
+   {
+      for (const std::string& file : files)
+      {
+         pixels += parse(file).getSprite().getPixels().size();
+      }
+   }
+   auto end = std::chrono::steady_clock::now();
+
+   // Keeps the parses from being optimized away
+   if (pixels == 0)
+   {
+      std::cerr << "Warning: no pixels parsed" << std::endl;
+   }
+
+   double elapsed = std::chrono::duration<double, std::micro>(end - start).count();
+   return elapsed / (static_cast<double>(iterations) * files.size());
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Usage: frameparserbenchmark [--iterations N] [animationsRoot...]
+///
+/// Finds every text frame below the roots, checks both parsers produce the same frame for each, then times
+/// them. Sparse style frames, manifests and sheets are skipped since the reference parser cannot read them.
+/// The root defaults to tests/Test Animations. Exits with 1 if any frame differs.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+   std::vector<std::string> roots;
+   int                      iterations = 200;
+   for (int i = 1; i < argc; i++)
+   {
+      if (std::string(argv[i]) == "--iterations" && i + 1 < argc)
+      {
+         iterations = std::max(1, std::atoi(argv[++i]));
+         continue;
+      }
+      roots.push_back(argv[i]);
+   }
+   if (roots.empty())
+   {
+      roots.push_back("tests/Test Animations");
+   }
+
+   std::vector<std::string> files;
+   int                      skipped = 0;
+   for (const std::string& root : roots)
+   {
+      std::error_code error;
+      for (fs::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error))
+      {
+         const fs::path& path = it->path();
+         std::string     name = path.filename().string();
+         if (!it->is_regular_file(error) || path.extension() != ".txt")
+            continue;
+
+         if (name == AnimationManifest::FILE_NAME || name == AnimationSheet::FILE_NAME ||
+             isSparseFrame(path.string()))
+         {
+            skipped++;
+            continue;
+         }
+         files.push_back(path.string());
+      }
+      if (error)
+      {
+         std::cerr << "Filesystem error: " << root << ": " << error.message() << std::endl;
+      }
+   }
+
+   if (files.empty())
+   {
+      std::cerr << "No text frames found" << std::endl;
+      return 1;
+   }
+
+   int mismatches = 0;
+   for (const std::string& file : files)
+   {
+      if (!sameFrames(referenceGetFrameFromTextFile(file), PrintableFactory::getFrameFromTextFile(file)))
+      {
+         std::cerr << "Frames differ: " << file << std::endl;
+         mismatches++;
+      }
+   }
+
+   double reference = microsecondsPerFile(files, iterations, referenceGetFrameFromTextFile);
+   double current   = microsecondsPerFile(files, iterations, PrintableFactory::getFrameFromTextFile);
+
+   std::cout << files.size() << " frames (" << skipped << " skipped), " << iterations << " iterations"
+             << std::endl;
+   std::cout << "Reference parser:     " << reference << " us per file" << std::endl;
+   std::cout << "getFrameFromTextFile: " << current << " us per file" << std::endl;
+   std::cout << "Speedup:              " << reference / current << "x" << std::endl;
+   if (mismatches > 0)
+   {
+      std::cout << mismatches << " frames differ" << std::endl;
+   }
+   return mismatches > 0 ? 1 : 0;
+}